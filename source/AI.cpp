@@ -15,8 +15,10 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 
 #include "AI.h"
 
+#include "AttributeKeys.h"
 #include "Audio.h"
 #include "Command.h"
+#include "Dictionary.h"
 #include "DistanceMap.h"
 #include "Flotsam.h"
 #include "GameData.h"
@@ -40,6 +42,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "StellarObject.h"
 #include "System.h"
 #include "Weapon.h"
+#include "WorkerPool.h"
 #include "Wormhole.h"
 
 #include <algorithm>
@@ -47,6 +50,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include <limits>
 #include <set>
 
+using namespace AttributeKeys;
 using namespace std;
 
 namespace {
@@ -201,7 +205,7 @@ namespace {
 	bool ShouldRefuel(const Ship &ship, const DistanceMap &route, double fuelCapacity = 0.)
 	{
 		if(!fuelCapacity)
-			fuelCapacity = ship.Attributes().Get("fuel capacity");
+			fuelCapacity = ship.Attributes().Get(FUEL_CAPACITY);
 
 		const System *from = ship.GetSystem();
 		const bool systemHasFuel = from->HasFuelFor(ship) && fuelCapacity;
@@ -324,6 +328,12 @@ namespace {
 		return true;
 	}
 
+	// Check whether two pointers refer to the same ship, even if it no longer exists.
+	bool IsSameShip(const weak_ptr<const Ship> &first, const weak_ptr<const Ship> &second)
+	{
+		return !first.owner_before(second) && !second.owner_before(first);
+	}
+
 	// Constants for the invisible fence timer.
 	const int FENCE_DECAY = 4;
 	const int FENCE_MAX = 600;
@@ -337,8 +347,10 @@ namespace {
 
 
 
-AI::AI(const List<Ship> &ships, const List<Minable> &minables, const List<Flotsam> &flotsam)
-	: ships(ships), minables(minables), flotsam(flotsam)
+AI::AI(const List<Ship> &ships, const List<Minable> &minables, const List<Flotsam> &flotsam, WorkerPool &workers,
+		FrameArena &frameArena)
+	: ships(ships), minables(minables), flotsam(flotsam), workers(workers), frameArena(frameArena),
+	rosterSet(2048u, 16u)
 {
 	// Allocate a starting amount of hardpoints for ships.
 	firingCommands.SetHardpoints(12);
@@ -412,7 +424,7 @@ void AI::UpdateKeys(PlayerInfo &player, Command &activeCommands)
 	// Only toggle the "cloak" command if one of your ships has a cloaking device.
 	if(activeCommands.Has(Command::CLOAK))
 		for(const auto &it : player.Ships())
-			if(!it->IsParked() && it->Attributes().Get("cloak"))
+			if(!it->IsParked() && it->Attributes().Get(CLOAK))
 			{
 				isCloaking = !isCloaking;
 				Messages::Add(isCloaking ? "Engaging cloaking device." : "Disengaging cloaking device."
@@ -456,38 +468,45 @@ void AI::UpdateKeys(PlayerInfo &player, Command &activeCommands)
 	}
 
 	// Get rid of any invalid orders. Carried ships will retain orders in case they are deployed.
-	for(auto it = orders.begin(); it != orders.end(); )
+	for(ShipState &state : shipStates)
+		RemoveInvalidOrders(state, *flagship);
+	for(ShipState &state : unlistedStates)
+		RemoveInvalidOrders(state, *flagship);
+}
+
+
+
+// Get rid of the given ship's orders if they are no longer valid.
+void AI::RemoveInvalidOrders(ShipState &state, const Ship &flagship)
+{
+	if(!state.hasOrders || state.owner.expired())
+		return;
+	Orders &it = state.orders;
+	if(it.type == Orders::MINE && state.ship->Cargo().Free() && it.targetAsteroid.expired())
+		it.type = Orders::HARVEST;
+	else if(it.type & Orders::REQUIRES_TARGET)
 	{
-		if(it->second.type == Orders::MINE && it->first->Cargo().Free() && it->second.targetAsteroid.expired())
-			it->second.type = Orders::HARVEST;
-		else if(it->second.type & Orders::REQUIRES_TARGET)
-		{
-			shared_ptr<Ship> ship = it->second.target.lock();
-			shared_ptr<Minable> asteroid = it->second.targetAsteroid.lock();
-			// Check if the target ship itself is targetable.
-			bool invalidTarget = !ship || !ship->IsTargetable() || (ship->IsDisabled() && it->second.type == Orders::ATTACK);
-			// Alternately, if an asteroid is targeted, then not an invalid target.
-			invalidTarget &= !asteroid;
-			// Check if the target ship is in a system where we can target.
-			// This check only checks for undocked ships (that have a current system).
-			bool targetOutOfReach = !ship || (it->first->GetSystem() && ship->GetSystem() != it->first->GetSystem()
-					&& ship->GetSystem() != flagship->GetSystem());
-			// Asteroids are never out of reach since they're in the same system as flagship.
-			targetOutOfReach &= !asteroid;
-
-			if(invalidTarget || targetOutOfReach)
-			{
-				it = orders.erase(it);
-				continue;
-			}
-		}
-		++it;
+		shared_ptr<Ship> ship = it.target.lock();
+		shared_ptr<Minable> asteroid = it.targetAsteroid.lock();
+		// Check if the target ship itself is targetable.
+		bool invalidTarget = !ship || !ship->IsTargetable() || (ship->IsDisabled() && it.type == Orders::ATTACK);
+		// Alternately, if an asteroid is targeted, then not an invalid target.
+		invalidTarget &= !asteroid;
+		// Check if the target ship is in a system where we can target.
+		// This check only checks for undocked ships (that have a current system).
+		bool targetOutOfReach = !ship || (state.ship->GetSystem() && ship->GetSystem() != state.ship->GetSystem()
+				&& ship->GetSystem() != flagship.GetSystem());
+		// Asteroids are never out of reach since they're in the same system as flagship.
+		targetOutOfReach &= !asteroid;
+
+		if(invalidTarget || targetOutOfReach)
+			state.hasOrders = false;
 	}
 }
 
 
 
-void AI::UpdateEvents(const list<ShipEvent> &events)
+void AI::UpdateEvents(const vector<ShipEvent> &events)
 {
 	for(const ShipEvent &event : events)
 	{
@@ -495,11 +514,33 @@ void AI::UpdateEvents(const list<ShipEvent> &events)
 		if(!target)
 			continue;
 
+		// A ship that is provoked should reconsider who it is fighting, and so
+		// should a ship that has just disabled or destroyed its target.
+		if(event.Type() & ShipEvent::PROVOKE)
+			State(*target).retargetNow = true;
+		if(event.Actor() && (event.Type() & (ShipEvent::DISABLE | ShipEvent::DESTROY)))
+			State(*event.Actor()).retargetNow = true;
+
 		if(event.Actor())
 		{
-			actions[event.Actor()][target] |= event.Type();
-			if(event.TargetGovernment())
-				notoriety[event.Actor()][event.TargetGovernment()] |= event.Type();
+			ShipState &actor = State(*event.Actor());
+			auto ait = find_if(actor.actions.begin(), actor.actions.end(),
+				[&target](const pair<weak_ptr<const Ship>, int> &it) { return IsSameShip(it.first, target); });
+			if(ait == actor.actions.end())
+				actor.actions.emplace_back(target, event.Type());
+			else
+				ait->second |= event.Type();
+
+			const Government *targetGovernment = event.TargetGovernment();
+			if(targetGovernment)
+			{
+				auto git = find_if(actor.notoriety.begin(), actor.notoriety.end(),
+					[targetGovernment](const pair<const Government *, int> &it) { return it.first == targetGovernment; });
+				if(git == actor.notoriety.end())
+					actor.notoriety.emplace_back(targetGovernment, event.Type());
+				else
+					git->second |= event.Type();
+			}
 		}
 
 		const auto &actorGovernment = event.ActorGovernment();
@@ -508,7 +549,7 @@ void AI::UpdateEvents(const list<ShipEvent> &events)
 			governmentActions[actorGovernment][target] |= event.Type();
 			if(actorGovernment->IsPlayer() && event.TargetGovernment())
 			{
-				int &bitmap = playerActions[target];
+				int &bitmap = State(*target).playerActions;
 				int newActions = event.Type() - (event.Type() & bitmap);
 				bitmap |= event.Type();
 				// If you provoke the same ship twice, it should have an effect both times.
@@ -526,18 +567,12 @@ void AI::UpdateEvents(const list<ShipEvent> &events)
 // the player has entered a new one.
 void AI::Clean()
 {
-	actions.clear();
-	notoriety.clear();
+	for(ShipState &state : shipStates)
+		state.Clean();
+	for(ShipState &state : unlistedStates)
+		state.Clean();
 	governmentActions.clear();
 	scanPermissions.clear();
-	playerActions.clear();
-	swarmCount.clear();
-	fenceCount.clear();
-	miningAngle.clear();
-	miningRadius.clear();
-	miningTime.clear();
-	appeasementThreshold.clear();
-	shipStrength.clear();
 	enemyStrength.clear();
 	allyStrength.clear();
 }
@@ -548,14 +583,23 @@ void AI::Clean()
 // when the player lands, but not when they change systems.
 void AI::ClearOrders()
 {
-	helperList.clear();
-	orders.clear();
+	for(ShipState &state : shipStates)
+		state.ClearOrders();
+	for(ShipState &state : unlistedStates)
+		state.ClearOrders();
 }
 
 
 
 void AI::Step(const PlayerInfo &player, Command &activeCommands)
 {
+	// Bring the flat index of ships up to date. No ships are removed from the
+	// list while the AI is running, so its pointers stay good until Step() ends.
+	registry.Update(ships);
+	// Move the ships' states to their new slots, and forget about any ships
+	// that no longer exist.
+	RemoveStates();
+
 	// First, figure out the comparative strengths of the present governments.
 	const System *playerSystem = player.GetSystem();
 	map<const Government *, int64_t> strength;
@@ -563,34 +607,32 @@ void AI::Step(const PlayerInfo &player, Command &activeCommands)
 	CacheShipLists();
 
 	// Update the counts of how long ships have been outside the "invisible fence."
-	// If a ship ceases to exist, this also ensures that it will be removed from
-	// the fence count map after a few seconds.
-	for(auto it = fenceCount.begin(); it != fenceCount.end(); )
-	{
-		it->second -= FENCE_DECAY;
-		if(it->second < 0)
-			it = fenceCount.erase(it);
-		else
-			++it;
-	}
-	for(const auto &it : ships)
+	for(ShipState &state : shipStates)
+		if(state.fenceCount >= 0)
+			state.fenceCount = max(-1, state.fenceCount - FENCE_DECAY);
+	for(ShipState &state : unlistedStates)
+		if(state.fenceCount >= 0)
+			state.fenceCount = max(-1, state.fenceCount - FENCE_DECAY);
+	for(Ship *it : registry.Ships())
 	{
 		const System *system = it->GetActualSystem();
 		if(system && it->Position().Length() >= system->InvisibleFenceRadius())
 		{
-			int &value = fenceCount[&*it];
-			value = min(FENCE_MAX, value + FENCE_DECAY + 1);
+			int &value = State(*it).fenceCount;
+			value = min(FENCE_MAX, max(0, value) + FENCE_DECAY + 1);
 		}
 	}
 
 	const Ship *flagship = player.Flagship();
 	step = (step + 1) & 31;
-	int targetTurn = 0;
+	++decisionStep;
+	decisionInterval = GameData::GetGamerules().RetargetInterval();
 	int minerCount = 0;
 	const int maxMinerCount = minables.empty() ? 0 : 9;
 	bool opportunisticEscorts = !Preferences::Has("Turrets focus fire");
 	bool fightersRetreat = Preferences::Has("Damaged fighters retreat");
 	const int npcMaxMiningTime = GameData::GetGamerules().NPCMaxMiningTime();
+	fireControlCount = 0;
 	for(const auto &it : ships)
 	{
 		// A destroyed ship can't do anything.
@@ -632,7 +674,7 @@ void AI::Step(const PlayerInfo &player, Command &activeCommands)
 				if(personality.IsAppeasing())
 				{
 					double health = .5 * it->Shields() + it->Hull();
-					double &threshold = appeasementThreshold[it.get()];
+					double &threshold = State(*it).appeasementThreshold;
 					threshold = max((1. - health) + .1, threshold);
 				}
 				continue;
@@ -685,23 +727,35 @@ void AI::Step(const PlayerInfo &player, Command &activeCommands)
 			continue;
 		if(isPresent && !personality.IsSwarming())
 		{
-			// Each ship only switches targets twice a second, so that it can
-			// focus on damaging one particular ship.
-			targetTurn = (targetTurn + 1) & 31;
-			if(targetTurn == step || !target || target->IsDestroyed() || (target->IsDisabled() && personality.Disables())
+			// Each ship only switches targets every so often, so that it can
+			// focus on damaging one particular ship, unless something has just
+			// happened that calls for a new decision.
+			ShipState &state = State(*it);
+			bool retarget = state.retargetNow || IsDecisionTurn(*it);
+			state.retargetNow = false;
+			if(retarget || !target || target->IsDestroyed() || (target->IsDisabled() && personality.Disables())
 					|| (target->IsFleeing() && personality.IsMerciful()) || !target->IsTargetable())
 			{
 				target = FindTarget(*it);
-				it->SetTargetShip(target);
+				// Setting a target ship clears the target asteroid, so a miner
+				// that still has nothing to fight keeps the asteroid it is
+				// mining, instead of waiting for its next turn to find another.
+				if(target || it->GetTargetShip())
+					it->SetTargetShip(target);
 			}
 		}
+		// Gather this ship's targets now, but leave aiming and firing at them
+		// until every ship has decided what to do.
+		FireControl *control = nullptr;
 		if(isPresent)
 		{
-			AimTurrets(*it, firingCommands, it->IsYours() ? opportunisticEscorts : personality.IsOpportunistic());
+			control = &NextFireControl(*it);
+			FindTurretTargets(*it, firingCommands, it->IsYours() ? opportunisticEscorts : personality.IsOpportunistic(),
+				control->turretTargets);
 			if(targetAsteroid)
 				AutoFire(*it, firingCommands, *targetAsteroid);
 			else
-				AutoFire(*it, firingCommands);
+				FindFireTargets(*it, true, false, *control);
 		}
 
 		// If this ship is hyperspacing, or in the act of
@@ -709,7 +763,7 @@ void AI::Step(const PlayerInfo &player, Command &activeCommands)
 		if(it->IsHyperspacing() || it->Zoom() < 1.)
 		{
 			it->SetCommands(command);
-			it->SetCommands(firingCommands);
+			CommitFiring(*it, control);
 			continue;
 		}
 
@@ -758,7 +812,7 @@ void AI::Step(const PlayerInfo &player, Command &activeCommands)
 			}
 			// Appeasing ships jettison cargo to distract their pursuers.
 			if(personality.IsAppeasing() && it->Cargo().Used())
-				DoAppeasing(it, &appeasementThreshold[it.get()]);
+				DoAppeasing(it, &State(*it).appeasementThreshold);
 		}
 
 		// If recruited to assist a ship, follow through on the commitment
@@ -784,7 +838,7 @@ void AI::Step(const PlayerInfo &player, Command &activeCommands)
 			{
 				it->SetTargetShip(shipToAssist);
 				it->SetCommands(command);
-				it->SetCommands(firingCommands);
+				CommitFiring(*it, control);
 				continue;
 			}
 		}
@@ -797,7 +851,7 @@ void AI::Step(const PlayerInfo &player, Command &activeCommands)
 
 		// Special case: if the player's flagship tries to board a ship to
 		// refuel it, that escort should hold position for boarding.
-		isStranded |= (flagship && it == flagship->GetTargetShip() && CanBoard(*flagship, *it)
+		isStranded |= (flagship && it.get() == TargetShip(*flagship) && CanBoard(*flagship, *it)
 			&& autoPilot.Has(Command::BOARD));
 
 		// Stranded ships that have a helper need to stop and be assisted.
@@ -816,7 +870,7 @@ void AI::Step(const PlayerInfo &player, Command &activeCommands)
 			// Flock between allied, in-system ships.
 			DoSwarming(*it, command, target);
 			it->SetCommands(command);
-			it->SetCommands(firingCommands);
+			CommitFiring(*it, control);
 			continue;
 		}
 
@@ -836,7 +890,7 @@ void AI::Step(const PlayerInfo &player, Command &activeCommands)
 		{
 			DoSurveillance(*it, command, target);
 			it->SetCommands(command);
-			it->SetCommands(firingCommands);
+			CommitFiring(*it, control);
 			continue;
 		}
 
@@ -844,7 +898,7 @@ void AI::Step(const PlayerInfo &player, Command &activeCommands)
 		if(isPresent && personality.Harvests() && DoHarvesting(*it, command))
 		{
 			it->SetCommands(command);
-			it->SetCommands(firingCommands);
+			CommitFiring(*it, control);
 			continue;
 		}
 
@@ -854,7 +908,7 @@ void AI::Step(const PlayerInfo &player, Command &activeCommands)
 			// Miners with free cargo space and available mining time should mine. Mission NPCs
 			// should mine even if there are other miners or they have been mining a while.
 			if(it->Cargo().Free() >= 5 && IsArmed(*it) && (it->IsSpecial()
-					|| (++miningTime[&*it] < npcMaxMiningTime && ++minerCount < maxMinerCount)))
+					|| (++State(*it).miningTime < npcMaxMiningTime && ++minerCount < maxMinerCount)))
 			{
 				if(it->HasBays())
 				{
@@ -863,12 +917,13 @@ void AI::Step(const PlayerInfo &player, Command &activeCommands)
 				}
 				DoMining(*it, command);
 				it->SetCommands(command);
-				it->SetCommands(firingCommands);
+				CommitFiring(*it, control);
 				continue;
 			}
 			// Fighters and drones should assist their parent's mining operation if they cannot
 			// carry ore, and the asteroid is near enough that the parent can harvest the ore.
-			if(it->CanBeCarried() && parent && miningTime[parent.get()] < 3601)
+			const ShipState *parentState = parent ? FindState(*parent) : nullptr;
+			if(it->CanBeCarried() && parent && (!parentState || parentState->miningTime < 3601))
 			{
 				const shared_ptr<Minable> &minable = parent->GetTargetAsteroid();
 				if(minable && minable->Position().Distance(parent->Position()) < 600.)
@@ -877,7 +932,7 @@ void AI::Step(const PlayerInfo &player, Command &activeCommands)
 					MoveToAttack(*it, command, *minable);
 					AutoFire(*it, firingCommands, *minable);
 					it->SetCommands(command);
-					it->SetCommands(firingCommands);
+					CommitFiring(*it, control);
 					continue;
 				}
 			}
@@ -972,7 +1027,7 @@ void AI::Step(const PlayerInfo &player, Command &activeCommands)
 				MoveTo(*it, command, parent->Position(), parent->Velocity(), 40., .8);
 				command |= Command::BOARD;
 				it->SetCommands(command);
-				it->SetCommands(firingCommands);
+				CommitFiring(*it, control);
 				continue;
 			}
 			// If we get here, it means that the ship has not decided to return
@@ -1021,7 +1076,7 @@ void AI::Step(const PlayerInfo &player, Command &activeCommands)
 			MoveIndependent(*it, command);
 		else if(parent->GetSystem() != it->GetSystem())
 		{
-			if(personality.IsStaying() || !it->Attributes().Get("fuel capacity"))
+			if(personality.IsStaying() || !it->Attributes().Get(FUEL_CAPACITY))
 				MoveIndependent(*it, command);
 			else
 				MoveEscort(*it, command);
@@ -1073,8 +1128,24 @@ void AI::Step(const PlayerInfo &player, Command &activeCommands)
 		DoScatter(*it, command);
 
 		it->SetCommands(command);
-		it->SetCommands(firingCommands);
+		CommitFiring(*it, control);
 	}
+
+	// Now that all ships have decided on their orders, calculate how each of them
+	// should aim and fire. Each ship only writes to its own fire control entry.
+	auto aimAndFire = [this](size_t index) -> void
+	{
+		FireControl &control = fireControl[index];
+		if(!control.commit)
+			return;
+		AimTurrets(*control.ship, control.turretTargets, control.command);
+		if(control.autoFire)
+			AutoFire(*control.ship, control, control.command);
+	};
+	workers.Run(fireControlCount, aimAndFire);
+	for(size_t i = 0; i < fireControlCount; ++i)
+		if(fireControl[i].commit)
+			fireControl[i].ship->SetCommands(fireControl[i].command);
 }
 
 
@@ -1145,11 +1216,31 @@ bool AI::CanPursue(const Ship &ship, const Ship &target) const
 		return true;
 
 	// Check if the target is beyond the "invisible fence" for this system.
-	const auto fit = fenceCount.find(&target);
-	if(fit == fenceCount.end())
+	const ShipState *state = FindState(target);
+	if(!state || state->fenceCount < 0)
 		return true;
 	else
-		return (fit->second != FENCE_MAX);
+		return (state->fenceCount != FENCE_MAX);
+}
+
+
+
+// Check if it is the given ship's turn to reconsider its target, or to look
+// for an asteroid to mine. Each ship has its own turn, so that the work is
+// spread out over several steps.
+bool AI::IsDecisionTurn(const Ship &ship) const
+{
+	size_t index = ship.RegistryHandle().index;
+	return (decisionStep + index) % decisionInterval == 0;
+}
+
+
+
+// Check if the given ship has recently been outside the "invisible fence."
+bool AI::HasLeftFence(const Ship &ship) const
+{
+	const ShipState *state = FindState(ship);
+	return state && state->fenceCount >= 0;
 }
 
 
@@ -1164,12 +1255,12 @@ void AI::AskForHelp(Ship &ship, bool &isStranded, const Ship *flagship)
 		const Government *gov = ship.GetGovernment();
 		bool hasEnemy = false;
 
-		vector<Ship *> canHelp;
+		FrameVector<Ship *> canHelp{FrameAllocator<Ship *>(frameArena)};
 		canHelp.reserve(ships.size());
-		for(const auto &helper : ships)
+		for(Ship *helper : registry.Ships())
 		{
 			// Never ask yourself for help.
-			if(helper.get() == &ship)
+			if(helper == &ship)
 				continue;
 
 			// If any able enemies of this ship are in its system, it cannot call for help.
@@ -1192,13 +1283,13 @@ void AI::AskForHelp(Ship &ship, bool &isStranded, const Ship *flagship)
 			if(helper->GetTargetAsteroid() || helper->GetTargetFlotsam())
 				continue;
 			// Your escorts only help other escorts, and your flagship never helps.
-			if((helper->IsYours() && !ship.IsYours()) || helper.get() == flagship)
+			if((helper->IsYours() && !ship.IsYours()) || helper == flagship)
 				continue;
 			// Your escorts should not help each other if already under orders.
-			auto foundOrders = orders.find(helper.get());
-			if(foundOrders != orders.end())
+			const Orders *foundOrders = FindOrders(*helper);
+			if(foundOrders)
 			{
-				int helperOrders = foundOrders->second.type;
+				int helperOrders = foundOrders->type;
 				// If your own escorts become disabled, then your mining fleet
 				// should prioritize repairing escorts instead of mining or
 				// harvesting flotsam.
@@ -1211,14 +1302,16 @@ void AI::AskForHelp(Ship &ship, bool &isStranded, const Ship *flagship)
 				continue;
 
 			// Prefer fast ships over slow ones.
-			canHelp.insert(canHelp.end(), 1 + .3 * helper->MaxVelocity(), helper.get());
+			canHelp.insert(canHelp.end(), 1 + .3 * helper->MaxVelocity(), helper);
 		}
 
 		if(!hasEnemy && !canHelp.empty())
 		{
 			Ship *helper = canHelp[Random::Int(canHelp.size())];
 			helper->SetShipToAssist((&ship)->shared_from_this());
-			helperList[&ship] = helper->shared_from_this();
+			ShipState &state = State(ship);
+			state.hasHelper = true;
+			state.helper = helper->shared_from_this();
 			isStranded = true;
 		}
 		else
@@ -1234,7 +1327,8 @@ void AI::AskForHelp(Ship &ship, bool &isStranded, const Ship *flagship)
 bool AI::CanHelp(const Ship &ship, const Ship &helper, const bool needsFuel) const
 {
 	// A ship being assisted cannot assist.
-	if(helperList.find(&helper) != helperList.end())
+	const ShipState *helperState = FindState(helper);
+	if(helperState && helperState->hasHelper)
 		return false;
 
 	// Fighters, drones, and disabled / absent ships can't offer assistance.
@@ -1260,13 +1354,17 @@ bool AI::CanHelp(const Ship &ship, const Ship &helper, const bool needsFuel) con
 bool AI::HasHelper(const Ship &ship, const bool needsFuel)
 {
 	// Do we have an existing ship that was asked to assist?
-	if(helperList.find(&ship) != helperList.end())
+	ShipState *state = FindState(ship);
+	if(state && state->hasHelper)
 	{
-		shared_ptr<Ship> helper = helperList[&ship].lock();
+		shared_ptr<Ship> helper = state->helper.lock();
 		if(helper && helper->GetShipToAssist().get() == &ship && CanHelp(ship, *helper, needsFuel))
 			return true;
 		else
-			helperList.erase(&ship);
+		{
+			state->hasHelper = false;
+			state->helper.reset();
+		}
 	}
 
 	return false;
@@ -1286,9 +1384,9 @@ shared_ptr<Ship> AI::FindTarget(const Ship &ship) const
 	bool isYours = ship.IsYours();
 	if(isYours)
 	{
-		auto it = orders.find(&ship);
-		if(it != orders.end() && (it->second.type == Orders::ATTACK || it->second.type == Orders::FINISH_OFF))
-			return it->second.target.lock();
+		const Orders *it = FindOrders(ship);
+		if(it && (it->type == Orders::ATTACK || it->type == Orders::FINISH_OFF))
+			return it->target.lock();
 	}
 
 	// If this ship is not armed, do not make it fight.
@@ -1332,12 +1430,20 @@ shared_ptr<Ship> AI::FindTarget(const Ship &ship) const
 	bool canPlunder = person.Plunders() && ship.Cargo().Free() && !ship.CanBeCarried();
 	// Figure out how strong this ship is.
 	int64_t maxStrength = 0;
-	auto strengthIt = shipStrength.find(&ship);
-	if(!person.IsDaring() && strengthIt != shipStrength.end())
-		maxStrength = 2 * strengthIt->second;
-
-	// Get a list of all targetable, hostile ships in this system.
-	const auto enemies = GetShipsList(ship, true);
+	const ShipState *state = FindState(ship);
+	if(!person.IsDaring() && state)
+		maxStrength = 2 * state->strength;
+
+	// Get a list of all targetable, hostile ships in this system. Unless this
+	// ship is hunting or looking for a nemesis, it will only pick a ship that
+	// scores lower than "closest," and no ship scores much lower than how far
+	// away it will be a second from now, so only ships that could be that
+	// close need to be considered.
+	double searchRange = -1.;
+	if(!person.IsHunting() && !person.IsNemesis())
+		searchRange = closest + 60. * (ship.Velocity().Length() + maxRosterSpeed)
+			+ 500. + 2000. * canPlunder - minTargetBonus + 1.;
+	const auto enemies = ShipsList(ship, true, searchRange);
 	for(const auto &foe : enemies)
 	{
 		// If this is a "nemesis" ship and it has found one of the player's
@@ -1360,8 +1466,8 @@ shared_ptr<Ship> AI::FindTarget(const Ship &ship) const
 		// Unless this ship is "daring", it should not chase much stronger ships.
 		if(maxStrength && range > 1000. && !foe->IsDisabled())
 		{
-			const auto otherStrengthIt = shipStrength.find(foe);
-			if(otherStrengthIt != shipStrength.end() && otherStrengthIt->second > maxStrength)
+			const ShipState *foeState = FindState(*foe);
+			if(foeState && foeState->strength > maxStrength)
 				continue;
 		}
 
@@ -1420,11 +1526,11 @@ shared_ptr<Ship> AI::FindTarget(const Ship &ship) const
 shared_ptr<Ship> AI::FindNonHostileTarget(const Ship &ship) const
 {
 	shared_ptr<Ship> target;
-	bool cargoScan = ship.Attributes().Get("cargo scan power");
-	bool outfitScan = ship.Attributes().Get("outfit scan power");
+	bool cargoScan = ship.Attributes().Get(CARGO_SCAN_POWER);
+	bool outfitScan = ship.Attributes().Get(OUTFIT_SCAN_POWER);
 	if(cargoScan || outfitScan)
 	{
-		const auto allies = GetShipsList(ship, false);
+		const auto allies = ShipsList(ship, false);
 		// If this ship already has a target, and is in the process of scanning it, prioritise that.
 		shared_ptr<Ship> oldTarget = ship.GetTargetShip();
 		if(oldTarget && !oldTarget->IsTargetable())
@@ -1468,30 +1574,63 @@ shared_ptr<Ship> AI::FindNonHostileTarget(const Ship &ship) const
 // match the desired hostility (i.e. enemy or non-enemy). Does not consider the
 // ship's current target, as its inclusion may or may not be desired.
 vector<Ship *> AI::GetShipsList(const Ship &ship, bool targetEnemies, double maxRange) const
+{
+	FrameVector<Ship *> targets = ShipsList(ship, targetEnemies, maxRange);
+	return vector<Ship *>(targets.begin(), targets.end());
+}
+
+
+
+FrameVector<Ship *> AI::ShipsList(const Ship &ship, bool targetEnemies, double maxRange) const
 {
 	if(maxRange < 0.)
 		maxRange = numeric_limits<double>::infinity();
 
-	auto targets = vector<Ship *>();
+	FrameVector<Ship *> targets{FrameAllocator<Ship *>(frameArena)};
 
 	// The cached lists are built each step based on the current ships in the player's system.
 	const auto &rosters = targetEnemies ? enemyLists : allyLists;
 
 	const auto it = rosters.find(ship.GetGovernment());
-	if(it != rosters.end() && !it->second.empty())
+	if(it == rosters.end() || it->second.empty())
+		return targets;
+
+	const System *here = ship.GetSystem();
+	const Point &p = ship.Position();
+	auto isCandidate = [&ship, here, &p, maxRange](const Ship &target) -> bool
 	{
-		targets.reserve(it->second.size());
+		return target.IsTargetable() && target.GetSystem() == here
+			&& !(target.IsHyperspacing() && target.Velocity().Length() > 10.)
+			&& p.Distance(target.Position()) < maxRange
+			&& (ship.IsYours() || !target.GetPersonality().IsMarked())
+			&& (target.IsYours() || !ship.GetPersonality().IsMarked());
+	};
 
-		const System *here = ship.GetSystem();
-		const Point &p = ship.Position();
+	if(maxRange == numeric_limits<double>::infinity())
+	{
+		targets.reserve(it->second.size());
 		for(const auto &target : it->second)
-			if(target->IsTargetable() && target->GetSystem() == here
-					&& !(target->IsHyperspacing() && target->Velocity().Length() > 10.)
-					&& p.Distance(target->Position()) < maxRange
-					&& (ship.IsYours() || !target->GetPersonality().IsMarked())
-					&& (target->IsYours() || !ship.GetPersonality().IsMarked()))
+			if(isCandidate(*target))
 				targets.emplace_back(target);
+		return targets;
+	}
+
+	// If the range is limited, only check the ships that are in range. They
+	// are returned in the same order as they appear in the cached lists.
+	vector<Body *> &nearby = nearbyShips;
+	rosterSet.Circle(p, maxRange, nearby);
+	FrameVector<pair<int, Ship *>> found{FrameAllocator<pair<int, Ship *>>(frameArena)};
+	const Government *gov = ship.GetGovernment();
+	for(Body *body : nearby)
+	{
+		Ship *target = reinterpret_cast<Ship *>(body);
+		if(gov->IsEnemy(target->GetGovernment()) == targetEnemies && isCandidate(*target))
+			found.emplace_back(rosterIndices[target->RegistryHandle().index], target);
 	}
+	sort(found.begin(), found.end());
+	targets.reserve(found.size());
+	for(const auto &target : found)
+		targets.push_back(target.second);
 
 	return targets;
 }
@@ -1500,11 +1639,11 @@ vector<Ship *> AI::GetShipsList(const Ship &ship, bool targetEnemies, double max
 
 bool AI::FollowOrders(Ship &ship, Command &command) const
 {
-	auto it = orders.find(&ship);
-	if(it == orders.end())
+	const Orders *it = FindOrders(ship);
+	if(!it)
 		return false;
 
-	int type = it->second.type;
+	int type = it->type;
 
 	// If your parent is jumping or absent, that overrides your orders unless
 	// your orders are to hold position.
@@ -1523,14 +1662,14 @@ bool AI::FollowOrders(Ship &ship, Command &command) const
 		return false;
 	}
 
-	shared_ptr<Ship> target = it->second.target.lock();
-	shared_ptr<Minable> targetAsteroid = it->second.targetAsteroid.lock();
-	if(type == Orders::MOVE_TO && it->second.targetSystem && ship.GetSystem() != it->second.targetSystem)
+	shared_ptr<Ship> target = it->target.lock();
+	shared_ptr<Minable> targetAsteroid = it->targetAsteroid.lock();
+	if(type == Orders::MOVE_TO && it->targetSystem && ship.GetSystem() != it->targetSystem)
 	{
 		// The desired position is in a different system. Find the best
 		// way to reach that system (via wormhole or jumping). This may
 		// result in the ship landing to refuel.
-		SelectRoute(ship, it->second.targetSystem);
+		SelectRoute(ship, it->targetSystem);
 
 		// Travel there even if your parent is not planning to travel.
 		if((ship.GetTargetSystem() && ship.JumpsRemaining()) || ship.GetTargetStellar())
@@ -1538,11 +1677,11 @@ bool AI::FollowOrders(Ship &ship, Command &command) const
 		else
 			return false;
 	}
-	else if((type == Orders::MOVE_TO || type == Orders::HOLD_ACTIVE) && ship.Position().Distance(it->second.point) > 20.)
-		MoveTo(ship, command, it->second.point, Point(), 10., .1);
+	else if((type == Orders::MOVE_TO || type == Orders::HOLD_ACTIVE) && ship.Position().Distance(it->point) > 20.)
+		MoveTo(ship, command, it->point, Point(), 10., .1);
 	else if(type == Orders::HOLD_POSITION || type == Orders::HOLD_ACTIVE || type == Orders::MOVE_TO)
 	{
-		if(ship.Velocity().Length() > .001 || !ship.GetTargetShip())
+		if(ship.Velocity().Length() > .001 || !TargetShip(ship))
 			Stop(ship, command);
 		else
 			command.SetTurn(TurnToward(ship, TargetAim(ship)));
@@ -1613,13 +1752,13 @@ void AI::MoveIndependent(Ship &ship, Command &command) const
 	bool ignoreTargetShip = false;
 	if(ship.IsYours())
 	{
-		auto it = orders.find(&ship);
-		if(it != orders.end())
+		const Orders *it = FindOrders(ship);
+		if(it)
 		{
-			if(it->second.type == Orders::MOVE_TO)
+			if(it->type == Orders::MOVE_TO)
 				ignoreTargetShip = (ship.GetTargetSystem() && ship.JumpsRemaining()) || ship.GetTargetStellar();
-			else if(it->second.type == Orders::ATTACK || it->second.type == Orders::FINISH_OFF)
-				friendlyOverride = it->second.target.lock() == target;
+			else if(it->type == Orders::ATTACK || it->type == Orders::FINISH_OFF)
+				friendlyOverride = it->target.lock() == target;
 		}
 	}
 	const Government *gov = ship.GetGovernment();
@@ -1645,8 +1784,8 @@ void AI::MoveIndependent(Ship &ship, Command &command) const
 	else if(target)
 	{
 		// An AI ship that is targeting a non-hostile ship should scan it, or move on.
-		bool cargoScan = ship.Attributes().Get("cargo scan power");
-		bool outfitScan = ship.Attributes().Get("outfit scan power");
+		bool cargoScan = ship.Attributes().Get(CARGO_SCAN_POWER);
+		bool outfitScan = ship.Attributes().Get(OUTFIT_SCAN_POWER);
 		// De-target if the target left my system.
 		if(ship.GetSystem() != target->GetSystem())
 		{
@@ -1775,7 +1914,7 @@ void AI::MoveIndependent(Ship &ship, Command &command) const
 	else if(ship.GetTargetStellar())
 	{
 		MoveToPlanet(ship, command);
-		if(!shouldStay && ship.Attributes().Get("fuel capacity") && ship.GetTargetStellar()->HasSprite()
+		if(!shouldStay && ship.Attributes().Get(FUEL_CAPACITY) && ship.GetTargetStellar()->HasSprite()
 				&& ship.GetTargetStellar()->GetPlanet() && ship.GetTargetStellar()->GetPlanet()->CanLand(ship))
 			command |= Command::LAND;
 		else if(ship.Position().Distance(ship.GetTargetStellar()->Position()) < 100.)
@@ -1797,7 +1936,7 @@ void AI::MoveEscort(Ship &ship, Command &command) const
 {
 	const Ship &parent = *ship.GetParent();
 	const System *currentSystem = ship.GetSystem();
-	bool hasFuelCapacity = ship.Attributes().Get("fuel capacity");
+	bool hasFuelCapacity = ship.Attributes().Get(FUEL_CAPACITY);
 	bool needsFuel = ship.NeedsFuel();
 	bool isStaying = ship.GetPersonality().IsStaying() || !hasFuelCapacity;
 	bool parentIsHere = (currentSystem == parent.GetSystem());
@@ -1933,7 +2072,7 @@ void AI::MoveEscort(Ship &ship, Command &command) const
 		else
 			KeepStation(ship, command, parent);
 	}
-	else if(parent.Commands().Has(Command::BOARD) && parent.GetTargetShip().get() == &ship)
+	else if(parent.Commands().Has(Command::BOARD) && TargetShip(parent) == &ship)
 		Stop(ship, command, .2);
 	else
 		KeepStation(ship, command, parent);
@@ -2030,9 +2169,9 @@ bool AI::ShouldDock(const Ship &ship, const Ship &parent, const System *playerSy
 
 	// If a carried ship has fuel capacity but is very low, it should return if
 	// the parent can refuel it.
-	double maxFuel = ship.Attributes().Get("fuel capacity");
+	double maxFuel = ship.Attributes().Get(FUEL_CAPACITY);
 	if(maxFuel && ship.Fuel() < .005 && parent.JumpNavigation().JumpFuel() < parent.Fuel() *
-			parent.Attributes().Get("fuel capacity") - maxFuel)
+			parent.Attributes().Get(FUEL_CAPACITY) - maxFuel)
 		return true;
 
 	// NPC ships should always transfer cargo. Player ships should only
@@ -2041,7 +2180,8 @@ bool AI::ShouldDock(const Ship &ship, const Ship &parent, const System *playerSy
 	{
 		// If an out-of-combat carried ship is carrying a significant cargo
 		// load and can transfer some of it to the parent, it should do so.
-		bool hasEnemy = ship.GetTargetShip() && ship.GetTargetShip()->GetGovernment()->IsEnemy(ship.GetGovernment());
+		const Ship *target = TargetShip(ship);
+		bool hasEnemy = target && target->GetGovernment()->IsEnemy(ship.GetGovernment());
 		if(!hasEnemy && parent.Cargo().Free())
 		{
 			const CargoHold &cargo = ship.Cargo();
@@ -2169,7 +2309,7 @@ bool AI::Stop(Ship &ship, Command &command, double maxSpeed, const Point directi
 
 	// If you have a reverse thruster, figure out whether using it is faster
 	// than turning around and using your main thruster.
-	if(ship.Attributes().Get("reverse thrust"))
+	if(ship.Attributes().Get(REVERSE_THRUST))
 	{
 		// Figure out your stopping time using your main engine:
 		double degreesToTurn = TO_DEG * acos(min(1., max(-1., -velocity.Unit().Dot(angle.Unit()))));
@@ -2177,7 +2317,7 @@ bool AI::Stop(Ship &ship, Command &command, double maxSpeed, const Point directi
 		forwardTime += stopTime;
 
 		// Figure out your reverse thruster stopping time:
-		double reverseAcceleration = ship.Attributes().Get("reverse thrust") / ship.InertialMass();
+		double reverseAcceleration = ship.Attributes().Get(REVERSE_THRUST) / ship.InertialMass();
 		double reverseTime = (180. - degreesToTurn) / ship.TurnRate();
 		reverseTime += speed / reverseAcceleration;
 
@@ -2216,7 +2356,7 @@ bool AI::Stop(Ship &ship, Command &command, double maxSpeed, const Point directi
 void AI::PrepareForHyperspace(Ship &ship, Command &command)
 {
 	bool hasHyperdrive = ship.JumpNavigation().HasHyperdrive();
-	double scramThreshold = ship.Attributes().Get("scram drive");
+	double scramThreshold = ship.Attributes().Get(SCRAM_DRIVE);
 	bool hasJumpDrive = ship.JumpNavigation().HasJumpDrive();
 	if(!hasHyperdrive && !hasJumpDrive)
 		return;
@@ -2266,9 +2406,9 @@ void AI::PrepareForHyperspace(Ship &ship, Command &command)
 	}
 	// If we're a jump drive, just stop.
 	else if(isJump)
-		Stop(ship, command, ship.Attributes().Get("jump speed"));
+		Stop(ship, command, ship.Attributes().Get(JUMP_SPEED));
 	// Else stop in the fastest way to end facing in the right direction
-	else if(Stop(ship, command, ship.Attributes().Get("jump speed"), direction))
+	else if(Stop(ship, command, ship.Attributes().Get(JUMP_SPEED), direction))
 		command.SetTurn(TurnToward(ship, direction));
 }
 
@@ -2380,11 +2520,11 @@ void AI::KeepStation(Ship &ship, Command &command, const Body &target)
 
 	// Determine whether to apply thrust.
 	Point drag = ship.Velocity() * ship.Drag() / mass;
-	if(ship.Attributes().Get("reverse thrust"))
+	if(ship.Attributes().Get(REVERSE_THRUST))
 	{
 		// Don't take drag into account when reverse thrusting, because this
 		// estimate of how it will be applied can be quite inaccurate.
-		Point a = (unit * (-ship.Attributes().Get("reverse thrust") / mass)).Unit();
+		Point a = (unit * (-ship.Attributes().Get(REVERSE_THRUST) / mass)).Unit();
 		double direction = positionWeight * positionDelta.Dot(a) / POSITION_DEADBAND
 			+ velocityWeight * velocityDelta.Dot(a) / VELOCITY_DEADBAND;
 		if(direction > THRUST_DEADBAND)
@@ -2508,7 +2648,7 @@ void AI::MoveToAttack(Ship &ship, Command &command, const Body &target)
 	const auto facing = ship.Facing().Unit().Dot(direction.Unit());
 	// If the ship has reverse thrusters and the target is behind it, we can
 	// use them to reach the target more quickly.
-	if(facing < -.75 && ship.Attributes().Get("reverse thrust"))
+	if(facing < -.75 && ship.Attributes().Get(REVERSE_THRUST))
 		command |= Command::BACK;
 	// This isn't perfect, but it works well enough.
 	else if((facing >= 0. && direction.Length() > diameter)
@@ -2557,18 +2697,18 @@ void AI::PickUp(Ship &ship, Command &command, const Body &target)
 // energy strain, or undue thermal loads if almost overheated.
 bool AI::ShouldUseAfterburner(Ship &ship)
 {
-	if(!ship.Attributes().Get("afterburner thrust"))
+	if(!ship.Attributes().Get(AFTERBURNER_THRUST))
 		return false;
 
-	double fuel = ship.Fuel() * ship.Attributes().Get("fuel capacity");
-	double neededFuel = ship.Attributes().Get("afterburner fuel");
-	double energy = ship.Energy() * ship.Attributes().Get("energy capacity");
-	double neededEnergy = ship.Attributes().Get("afterburner energy");
+	double fuel = ship.Fuel() * ship.Attributes().Get(FUEL_CAPACITY);
+	double neededFuel = ship.Attributes().Get(AFTERBURNER_FUEL);
+	double energy = ship.Energy() * ship.Attributes().Get(ENERGY_CAPACITY);
+	double neededEnergy = ship.Attributes().Get(AFTERBURNER_ENERGY);
 	if(energy == 0.)
-		energy = ship.Attributes().Get("energy generation")
-				+ 0.2 * ship.Attributes().Get("solar collection")
-				- ship.Attributes().Get("energy consumption");
-	double outputHeat = ship.Attributes().Get("afterburner heat") / (100 * ship.Mass());
+		energy = ship.Attributes().Get(ENERGY_GENERATION)
+				+ 0.2 * ship.Attributes().Get(SOLAR_COLLECTION)
+				- ship.Attributes().Get(ENERGY_CONSUMPTION);
+	double outputHeat = ship.Attributes().Get(AFTERBURNER_HEAT) / (100 * ship.Mass());
 	if((!neededFuel || fuel - neededFuel > ship.JumpNavigation().JumpFuel())
 			&& (!neededEnergy || neededEnergy / energy < 0.25)
 			&& (!outputHeat || ship.Heat() + outputHeat < .9))
@@ -2586,9 +2726,9 @@ void AI::DoAppeasing(const shared_ptr<Ship> &ship, double *threshold) const
 	if(1. - health <= *threshold)
 		return;
 
-	const auto enemies = GetShipsList(*ship, true);
-	if(none_of(enemies.begin(), enemies.end(), [&ship](const Ship *foe) noexcept -> bool
-			{ return !foe->IsDisabled() && foe->GetTargetShip() == ship; }))
+	const auto enemies = ShipsList(*ship, true);
+	if(none_of(enemies.begin(), enemies.end(), [this, &ship](const Ship *foe) noexcept -> bool
+			{ return !foe->IsDisabled() && TargetShip(*foe) == ship.get(); }))
 		return;
 
 	int toDump = 11 + (1. - health) * .5 * ship->Cargo().Size();
@@ -2618,9 +2758,9 @@ void AI::DoSwarming(Ship &ship, Command &command, shared_ptr<Ship> &target)
 		if(target)
 		{
 			// Allow another swarming ship to consider the target.
-			auto sit = swarmCount.find(target.get());
-			if(sit != swarmCount.end() && sit->second > 0)
-				--sit->second;
+			ShipState *targetState = FindState(*target);
+			if(targetState && targetState->swarmCount > 0)
+				--targetState->swarmCount;
 			// Release the current target.
 			target.reset();
 			ship.SetTargetShip(target);
@@ -2631,12 +2771,13 @@ void AI::DoSwarming(Ship &ship, Command &command, shared_ptr<Ship> &target)
 
 		int lowestCount = 7;
 		// Consider swarming around non-hostile ships in the same system.
-		const auto others = GetShipsList(ship, false);
+		const auto others = ShipsList(ship, false);
 		for(auto *other : others)
 			if(!other->GetPersonality().IsSwarming())
 			{
 				// Prefer to swarm ships that are not already being heavily swarmed.
-				int count = swarmCount[other] + Random::Int(4);
+				const ShipState *otherState = FindState(*other);
+				int count = (otherState ? otherState->swarmCount : 0) + Random::Int(4);
 				if(count < lowestCount)
 				{
 					target = other->shared_from_this();
@@ -2645,7 +2786,7 @@ void AI::DoSwarming(Ship &ship, Command &command, shared_ptr<Ship> &target)
 			}
 		ship.SetTargetShip(target);
 		if(target)
-			++swarmCount[target.get()];
+			++State(*target).swarmCount;
 	}
 	// If a friendly ship to flock with was not found, return to an available planet.
 	if(target)
@@ -2693,7 +2834,7 @@ void AI::DoSurveillance(Ship &ship, Command &command, shared_ptr<Ship> &target)
 	{
 		// Approach the planet and "land" on it (i.e. scan it).
 		MoveToPlanet(ship, command);
-		double atmosphereScan = ship.Attributes().Get("atmosphere scan");
+		double atmosphereScan = ship.Attributes().Get(ATMOSPHERE_SCAN);
 		double distance = ship.Position().Distance(ship.GetTargetStellar()->Position());
 		if(distance < atmosphereScan && !Random::Int(100))
 			ship.SetTargetStellar(nullptr);
@@ -2703,8 +2844,8 @@ void AI::DoSurveillance(Ship &ship, Command &command, shared_ptr<Ship> &target)
 	else if(target && target->IsTargetable())
 	{
 		// Approach and scan the targeted, friendly ship's cargo or outfits.
-		bool cargoScan = ship.Attributes().Get("cargo scan power");
-		bool outfitScan = ship.Attributes().Get("outfit scan power");
+		bool cargoScan = ship.Attributes().Get(CARGO_SCAN_POWER);
+		bool outfitScan = ship.Attributes().Get(OUTFIT_SCAN_POWER);
 		// If the pointer to the target ship exists, it is targetable and in-system.
 		bool mustScanCargo = cargoScan && !Has(ship, target, ShipEvent::SCAN_CARGO);
 		bool mustScanOutfits = outfitScan && !Has(ship, target, ShipEvent::SCAN_OUTFITS);
@@ -2725,9 +2866,9 @@ void AI::DoSurveillance(Ship &ship, Command &command, shared_ptr<Ship> &target)
 		const Government *gov = ship.GetGovernment();
 
 		// Consider scanning any non-hostile ship in this system that you haven't yet personally scanned.
-		vector<Ship *> targetShips;
-		bool cargoScan = ship.Attributes().Get("cargo scan power");
-		bool outfitScan = ship.Attributes().Get("outfit scan power");
+		FrameVector<Ship *> targetShips{FrameAllocator<Ship *>(frameArena)};
+		bool cargoScan = ship.Attributes().Get(CARGO_SCAN_POWER);
+		bool outfitScan = ship.Attributes().Get(OUTFIT_SCAN_POWER);
 		if(cargoScan || outfitScan)
 			for(const auto &grit : governmentRosters)
 			{
@@ -2746,15 +2887,15 @@ void AI::DoSurveillance(Ship &ship, Command &command, shared_ptr<Ship> &target)
 			}
 
 		// Consider scanning any planetary object in the system, if able.
-		vector<const StellarObject *> targetPlanets;
-		double atmosphereScan = ship.Attributes().Get("atmosphere scan");
+		FrameVector<const StellarObject *> targetPlanets{FrameAllocator<const StellarObject *>(frameArena)};
+		double atmosphereScan = ship.Attributes().Get(ATMOSPHERE_SCAN);
 		if(atmosphereScan)
 			for(const StellarObject &object : system->Objects())
 				if(object.HasSprite() && !object.IsStar() && !object.IsStation())
 					targetPlanets.push_back(&object);
 
 		// If this ship can jump away, consider traveling to a nearby system.
-		vector<const System *> targetSystems;
+		FrameVector<const System *> targetSystems{FrameAllocator<const System *>(frameArena)};
 		// TODO: These ships cannot travel through wormholes?
 		if(ship.JumpsRemaining(false))
 		{
@@ -2792,18 +2933,20 @@ void AI::DoMining(Ship &ship, Command &command)
 {
 	// This function is only called for ships that are in the player's system.
 	// Update the radius that the ship is searching for asteroids at.
-	bool isNew = !miningAngle.count(&ship);
-	Angle &angle = miningAngle[&ship];
-	if(isNew)
+	ShipState &state = State(ship);
+	Angle &angle = state.miningAngle;
+	if(!state.hasMiningAngle)
 	{
+		state.hasMiningAngle = true;
 		angle = Angle::Random();
-		miningRadius[&ship] = ship.GetSystem()->AsteroidBeltRadius();
+		state.miningRadius = ship.GetSystem()->AsteroidBeltRadius();
 	}
 	angle += Angle::Random(1.) - Angle::Random(1.);
-	double radius = miningRadius[&ship] * pow(2., angle.Unit().X());
+	double radius = state.miningRadius * pow(2., angle.Unit().X());
 
+	// Only look for a new asteroid when it is this ship's turn to make decisions.
 	shared_ptr<Minable> target = ship.GetTargetAsteroid();
-	if(!target || target->Velocity().Length() > ship.MaxVelocity())
+	if((!target || target->Velocity().Length() > ship.MaxVelocity()) && IsDecisionTurn(ship))
 	{
 		for(const shared_ptr<Minable> &minable : minables)
 		{
@@ -2910,16 +3053,16 @@ bool AI::DoCloak(Ship &ship, Command &command)
 		return false;
 
 	const Outfit &attributes = ship.Attributes();
-	if(!attributes.Get("cloak"))
+	if(!attributes.Get(CLOAK))
 		return false;
 
 	// Never cloak if it will cause you to be stranded.
-	double fuelCost = attributes.Get("cloaking fuel") + attributes.Get("fuel consumption")
-		- attributes.Get("fuel generation");
-	if(attributes.Get("cloaking fuel") && !attributes.Get("ramscoop"))
+	double fuelCost = attributes.Get(CLOAKING_FUEL) + attributes.Get(FUEL_CONSUMPTION)
+		- attributes.Get(FUEL_GENERATION);
+	if(attributes.Get(CLOAKING_FUEL) && !attributes.Get(RAMSCOOP))
 	{
-		double fuel = ship.Fuel() * attributes.Get("fuel capacity");
-		int steps = ceil((1. - ship.Cloaking()) / attributes.Get("cloak"));
+		double fuel = ship.Fuel() * attributes.Get(FUEL_CAPACITY);
+		int steps = ceil((1. - ship.Cloaking()) / attributes.Get(CLOAK));
 		// Only cloak if you will be able to fully cloak and also maintain it
 		// for as long as it will take you to reach full cloak.
 		fuel -= fuelCost * (1 + 2 * steps);
@@ -2954,7 +3097,7 @@ bool AI::DoCloak(Ship &ship, Command &command)
 	double range = MAX_RANGE;
 	const Ship *nearestEnemy = nullptr;
 	// Find the nearest targetable, in-system enemy that could attack this ship.
-	const auto enemies = GetShipsList(ship, true);
+	const auto enemies = ShipsList(ship, true);
 	for(const auto &foe : enemies)
 		if(!foe->IsDisabled())
 		{
@@ -2974,7 +3117,7 @@ bool AI::DoCloak(Ship &ship, Command &command)
 	bool cloakFreely = (fuelCost <= 0.) && !ship.GetShipToAssist() && !ship.IsYours();
 	// If this ship is injured / repairing, it should cloak while under threat.
 	bool cloakToRepair = (ship.Health() < RETREAT_HEALTH + hysteresis)
-			&& (attributes.Get("shield generation") || attributes.Get("hull repair rate"));
+			&& (attributes.Get(SHIELD_GENERATION) || attributes.Get(HULL_REPAIR_RATE));
 	if(cloakToRepair && (cloakFreely || range < 2000. * (1. + hysteresis)))
 	{
 		command |= Command::CLOAK;
@@ -2985,7 +3128,7 @@ bool AI::DoCloak(Ship &ship, Command &command)
 			// TODO: This could use an "Avoid" method, to account for other in-system hazards.
 			// Simple approximation: move equally away from both the system center and the
 			// nearest enemy, until the constrainment boundary is reached.
-			if(ship.GetPersonality().IsUnconstrained() || !fenceCount.count(&ship))
+			if(ship.GetPersonality().IsUnconstrained() || !HasLeftFence(ship))
 				safety = 2 * ship.Position().Unit() - nearestEnemy->Position().Unit();
 			else
 				safety = -ship.Position().Unit();
@@ -2996,7 +3139,7 @@ bool AI::DoCloak(Ship &ship, Command &command)
 		}
 	}
 	// Choose to cloak if there are no enemies nearby and cloaking is sensible.
-	if(range == MAX_RANGE && cloakFreely && !ship.GetTargetShip())
+	if(range == MAX_RANGE && cloakFreely && !TargetShip(ship))
 		command |= Command::CLOAK;
 
 	return false;
@@ -3014,10 +3157,10 @@ void AI::DoScatter(Ship &ship, Command &command)
 	double acceleration = ship.Acceleration();
 	// TODO: If there are many ships, use CollisionSet::Circle or another
 	// suitable method to limit which ships are checked.
-	for(const shared_ptr<Ship> &other : ships)
+	for(const Ship *other : registry.Ships())
 	{
 		// Do not scatter away from yourself, or ships in other systems.
-		if(other.get() == &ship || other->GetSystem() != ship.GetSystem())
+		if(other == &ship || other->GetSystem() != ship.GetSystem())
 			continue;
 
 		// Check for any ships that have nearly the same movement profile as
@@ -3043,10 +3186,10 @@ bool AI::DoSecretive(Ship &ship, Command &command)
 {
 	shared_ptr<Ship> scanningShip;
 	// Figure out if any ship is currently scanning us. If that is the case, move away from it.
-	for(auto &otherShip : GetShipsList(ship, false))
+	for(auto &otherShip : ShipsList(ship, false))
 		if(!ship.GetGovernment()->Trusts(otherShip->GetGovernment()) &&
 				otherShip->Commands().Has(Command::SCAN) &&
-				otherShip->GetTargetShip() == ship.shared_from_this() &&
+				TargetShip(*otherShip) == &ship &&
 				!otherShip->IsDisabled() && !otherShip->IsDestroyed())
 			scanningShip = make_shared<Ship>(*otherShip);
 
@@ -3055,8 +3198,8 @@ bool AI::DoSecretive(Ship &ship, Command &command)
 		Point scanningPos = scanningShip->Position();
 		Point pos = ship.Position();
 
-		double cargoDistance = scanningShip->Attributes().Get("cargo scan power");
-		double outfitDistance = scanningShip->Attributes().Get("outfit scan power");
+		double cargoDistance = scanningShip->Attributes().Get(CARGO_SCAN_POWER);
+		double outfitDistance = scanningShip->Attributes().Get(OUTFIT_SCAN_POWER);
 
 		double maxScanRange = max(cargoDistance, outfitDistance);
 		double distance = scanningPos.DistanceSquared(pos) * .0001;
@@ -3065,7 +3208,7 @@ bool AI::DoSecretive(Ship &ship, Command &command)
 		if(distance < maxScanRange)
 		{
 			Point away;
-			if(ship.GetPersonality().IsUnconstrained() || !fenceCount.count(&ship))
+			if(ship.GetPersonality().IsUnconstrained() || !HasLeftFence(ship))
 				away = pos - scanningPos;
 			else
 				away = -pos;
@@ -3113,10 +3256,10 @@ Point AI::StoppingPoint(const Ship &ship, const Point &targetVelocity, bool &sho
 	// The average term's value will be v / 2. So:
 	stopDistance += .5 * v * v / acceleration;
 
-	if(ship.Attributes().Get("reverse thrust"))
+	if(ship.Attributes().Get(REVERSE_THRUST))
 	{
 		// Figure out your reverse thruster stopping distance:
-		double reverseAcceleration = ship.Attributes().Get("reverse thrust") / ship.InertialMass();
+		double reverseAcceleration = ship.Attributes().Get(REVERSE_THRUST) / ship.InertialMass();
 		double reverseDistance = v * (180. - degreesToTurn) / turnRate;
 		reverseDistance += .5 * v * v / reverseAcceleration;
 
@@ -3182,9 +3325,32 @@ Point AI::TargetAim(const Ship &ship, const Body &target)
 // Aim the given ship's turrets.
 void AI::AimTurrets(const Ship &ship, FireCommand &command, bool opportunistic) const
 {
-	// First, get the set of potential hostile ships.
 	auto targets = vector<const Body *>();
-	const Ship *currentTarget = ship.GetTargetShip().get();
+	FindTurretTargets(ship, command, opportunistic, targets);
+	AimTurrets(ship, targets, command);
+}
+
+
+
+// Fire whichever of the given ship's weapons can hit a hostile target.
+void AI::AutoFire(const Ship &ship, FireCommand &command, bool secondary, bool isFlagship) const
+{
+	FireControl control;
+	FindFireTargets(ship, secondary, isFlagship, control);
+	if(control.autoFire)
+		AutoFire(ship, control, command);
+}
+
+
+
+// Find the bodies that the given ship's turrets should consider aiming at. If
+// there are none, the turrets are aimed right away.
+void AI::FindTurretTargets(const Ship &ship, FireCommand &command, bool opportunistic,
+	vector<const Body *> &targets) const
+{
+	// First, get the set of potential hostile ships.
+	targets.clear();
+	const Ship *currentTarget = TargetShip(ship);
 	if(opportunistic || !currentTarget || !currentTarget->IsTargetable())
 	{
 		// Find the maximum range of any of this ship's turrets.
@@ -3199,7 +3365,7 @@ void AI::AimTurrets(const Ship &ship, FireCommand &command, bool opportunistic)
 		maxRange *= 1.5;
 
 		// Now, find all enemy ships within that radius.
-		auto enemies = GetShipsList(ship, true, maxRange);
+		auto enemies = ShipsList(ship, true, maxRange);
 		// Convert the shared_ptr<Ship> into const Body *, to allow aiming turrets
 		// at a targeted asteroid. Skip disabled ships, which pose no threat.
 		for(auto &&foe : enemies)
@@ -3252,7 +3418,14 @@ void AI::AimTurrets(const Ship &ship, FireCommand &command, bool opportunistic)
 			}
 		return;
 	}
-	// Each hardpoint should aim at the target that it is "closest" to hitting.
+}
+
+
+
+// Aim each of the given ship's turrets at whichever of the targets it is
+// "closest" to hitting.
+void AI::AimTurrets(const Ship &ship, const vector<const Body *> &targets, FireCommand &command)
+{
 	for(const Hardpoint &hardpoint : ship.Weapons())
 		if(hardpoint.CanAim())
 		{
@@ -3329,9 +3502,16 @@ void AI::AimTurrets(const Ship &ship, FireCommand &command, bool opportunistic)
 
 
 
-// Fire whichever of the given ship's weapons can hit a hostile target.
-void AI::AutoFire(const Ship &ship, FireCommand &command, bool secondary, bool isFlagship) const
+// Gather everything the given ship's automatic fire depends on: which of its
+// weapons it is willing to use, and which ships it is willing to fire at.
+void AI::FindFireTargets(const Ship &ship, bool secondary, bool isFlagship, FireControl &control) const
 {
+	control.autoFire = false;
+	control.homingTarget = nullptr;
+	control.holdHomingFire = false;
+	control.homingTargetIsJumping = false;
+	control.enemies.clear();
+
 	const Personality &person = ship.GetPersonality();
 	if(person.IsPacifist() || ship.CannotAct())
 		return;
@@ -3360,11 +3540,11 @@ void AI::AutoFire(const Ship &ship, FireCommand &command, bool secondary, bool i
 	bool disabledOverride = false;
 	if(ship.IsYours())
 	{
-		auto it = orders.find(&ship);
-		if(it != orders.end() && it->second.target.lock() == currentTarget)
+		const Orders *it = FindOrders(ship);
+		if(it && it->target.lock() == currentTarget)
 		{
-			disabledOverride = (it->second.type == Orders::FINISH_OFF);
-			friendlyOverride = disabledOverride | (it->second.type == Orders::ATTACK);
+			disabledOverride = (it->type == Orders::FINISH_OFF);
+			friendlyOverride = disabledOverride | (it->type == Orders::ATTACK);
 		}
 	}
 	bool currentIsEnemy = currentTarget
@@ -3394,13 +3574,51 @@ void AI::AutoFire(const Ship &ship, FireCommand &command, bool secondary, bool i
 	maxRange *= 1.5;
 
 	// Find all enemy ships within range of at least one weapon.
-	auto enemies = GetShipsList(ship, true, maxRange);
+	auto enemies = ShipsList(ship, true, maxRange);
 	// Consider the current target if it is not already considered (i.e. it
 	// is a friendly ship and this is a player ship ordered to attack it).
 	if(currentTarget && currentTarget->IsTargetable()
 			&& find(enemies.cbegin(), enemies.cend(), currentTarget.get()) == enemies.cend())
 		enemies.push_back(currentTarget.get());
 
+	// Non-homing weapons may fire at any of those ships that this ship is
+	// willing to shoot at.
+	for(const Ship *target : enemies)
+	{
+		// NPCs shoot ships that they just plundered.
+		bool hasBoarded = !ship.IsYours() && Has(ship, target->shared_from_this(), ShipEvent::BOARD);
+		if(target->IsDisabled() && (disables || (plunders && !hasBoarded)) && !disabledOverride)
+			continue;
+		// Merciful ships let fleeing ships go.
+		if(target->IsFleeing() && person.IsMerciful())
+			continue;
+		control.enemies.emplace_back(target, &target->GetMask(step));
+	}
+	if(currentTarget)
+	{
+		// NPCs shoot ships that they just plundered.
+		bool hasBoarded = !ship.IsYours() && Has(ship, currentTarget, ShipEvent::BOARD);
+		control.holdHomingFire = currentTarget->IsDisabled() && (disables || (plunders && !hasBoarded))
+			&& !disabledOverride;
+		control.homingTargetIsJumping = currentTarget->IsEnteringHyperspace();
+	}
+
+	control.autoFire = true;
+	control.secondary = secondary;
+	control.isFlagship = isFlagship;
+	control.beFrugal = beFrugal;
+	control.isWaitingToJump = isWaitingToJump;
+	control.homingTarget = currentTarget.get();
+}
+
+
+
+// Fire whichever of the given ship's weapons can hit one of the targets that
+// were found for it.
+void AI::AutoFire(const Ship &ship, const FireControl &control, FireCommand &command)
+{
+	const Personality &person = ship.GetPersonality();
+	const Ship *currentTarget = control.homingTarget;
 	int index = -1;
 	for(const Hardpoint &hardpoint : ship.Weapons())
 	{
@@ -3410,7 +3628,7 @@ void AI::AutoFire(const Ship &ship, FireCommand &command, bool secondary, bool i
 			continue;
 
 		// Skip weapons omitted by the "Automatic firing" preference.
-		if(isFlagship)
+		if(control.isFlagship)
 		{
 			const Preferences::AutoFire autoFireMode = Preferences::GetAutoFire();
 			if(autoFireMode == Preferences::AutoFire::GUNS_ONLY && hardpoint.IsTurret())
@@ -3424,25 +3642,25 @@ void AI::AutoFire(const Ship &ship, FireCommand &command, bool secondary, bool i
 		if(!currentTarget && weapon->Homing() && weapon->Ammo())
 			continue;
 		// Don't fire secondary weapons if told not to.
-		if(!secondary && weapon->Icon())
+		if(!control.secondary && weapon->Icon())
 			continue;
 		// Don't expend ammo if trying to be frugal.
-		if(beFrugal && weapon->Ammo())
+		if(control.beFrugal && weapon->Ammo())
 			continue;
 		// Don't use weapons with firing force if you are preparing to jump.
-		if(isWaitingToJump && weapon->FiringForce())
+		if(control.isWaitingToJump && weapon->FiringForce())
 			continue;
 
 		// Special case: if the weapon uses fuel, be careful not to spend so much
 		// fuel that you cannot leave the system if necessary.
 		if(weapon->FiringFuel())
 		{
-			double fuel = ship.Fuel() * ship.Attributes().Get("fuel capacity");
+			double fuel = ship.Fuel() * ship.Attributes().Get(FUEL_CAPACITY);
 			fuel -= weapon->FiringFuel();
 			// If the ship is not ever leaving this system, it does not need to
 			// reserve any fuel.
 			bool isStaying = person.IsStaying();
-			if(!secondary || fuel < (isStaying ? 0. : ship.JumpNavigation().JumpFuel()))
+			if(!control.secondary || fuel < (isStaying ? 0. : ship.JumpNavigation().JumpFuel()))
 				continue;
 		}
 		// Figure out where this weapon will fire from, but add some randomness
@@ -3456,12 +3674,10 @@ void AI::AutoFire(const Ship &ship, FireCommand &command, bool secondary, bool i
 		// Homing weapons revert to "dumb firing" if they have no target.
 		if(weapon->Homing() && currentTarget)
 		{
-			// NPCs shoot ships that they just plundered.
-			bool hasBoarded = !ship.IsYours() && Has(ship, currentTarget, ShipEvent::BOARD);
-			if(currentTarget->IsDisabled() && (disables || (plunders && !hasBoarded)) && !disabledOverride)
+			if(control.holdHomingFire)
 				continue;
 			// Don't fire secondary weapons at targets that have started jumping.
-			if(weapon->Icon() && currentTarget->IsEnteringHyperspace())
+			if(weapon->Icon() && control.homingTargetIsJumping)
 				continue;
 
 			// For homing weapons, don't take the velocity of the ship firing it
@@ -3489,18 +3705,11 @@ void AI::AutoFire(const Ship &ship, FireCommand &command, bool secondary, bool i
 			continue;
 		}
 		// For non-homing weapons:
-		for(const auto &target : enemies)
+		for(const auto &enemy : control.enemies)
 		{
-			// NPCs shoot ships that they just plundered.
-			bool hasBoarded = !ship.IsYours() && Has(ship, target->shared_from_this(), ShipEvent::BOARD);
-			if(target->IsDisabled() && (disables || (plunders && !hasBoarded)) && !disabledOverride)
-				continue;
-			// Merciful ships let fleeing ships go.
-			if(target->IsFleeing() && person.IsMerciful())
-				continue;
-
-			Point p = target->Position() - start;
-			Point v = target->Velocity();
+			const Ship &target = *enemy.first;
+			Point p = target.Position() - start;
+			Point v = target.Velocity();
 			// Only take the ship's velocity into account if this weapon
 			// does not have its own acceleration.
 			if(!weapon->Acceleration())
@@ -3519,8 +3728,8 @@ void AI::AutoFire(const Ship &ship, FireCommand &command, bool secondary, bool i
 			// Extrapolate over the lifetime of the projectile.
 			v *= lifetime;
 
-			const Mask &mask = target->GetMask(step);
-			if(mask.Collide(-p, v, target->Facing()) < 1.)
+			const Mask &mask = *enemy.second;
+			if(mask.Collide(-p, v, target.Facing()) < 1.)
 			{
 				command.SetFire(index);
 				break;
@@ -3573,6 +3782,40 @@ void AI::AutoFire(const Ship &ship, FireCommand &command, const Body &target) co
 
 
 
+AI::FireControl &AI::NextFireControl(Ship &ship)
+{
+	if(fireControlCount == fireControl.size())
+		fireControl.emplace_back();
+	FireControl &control = fireControl[fireControlCount++];
+	control.ship = &ship;
+	control.turretTargets.clear();
+	control.autoFire = false;
+	control.commit = false;
+
+	// Weapons calculate their total lifetime the first time it is needed. Make
+	// sure that has happened before it can be read from several threads at once.
+	for(const Hardpoint &hardpoint : ship.Weapons())
+		if(hardpoint.GetOutfit())
+			hardpoint.GetOutfit()->TotalLifetime();
+
+	return control;
+}
+
+
+
+void AI::CommitFiring(Ship &ship, FireControl *control)
+{
+	if(control)
+	{
+		control->command = firingCommands;
+		control->commit = true;
+	}
+	else
+		ship.SetCommands(firingCommands);
+}
+
+
+
 // Get the amount of time it would take the given weapon to reach the given
 // target, assuming it can be fired in any direction (i.e. turreted). For
 // non-turreted weapons this can be used to calculate the ideal direction to
@@ -3615,7 +3858,7 @@ double AI::RendezvousTime(const Point &p, const Point &v, double vp)
 // on the player's preferences.
 bool AI::TargetMinable(Ship &ship) const
 {
-	double scanRangeMetric = 10000. * ship.Attributes().Get("asteroid scan power");
+	double scanRangeMetric = 10000. * ship.Attributes().Get(ASTEROID_SCAN_POWER);
 	if(!scanRangeMetric)
 		return false;
 	const bool findClosest = Preferences::Has("Target asteroid based on");
@@ -3884,7 +4127,7 @@ void AI::MovePlayer(Ship &ship, const PlayerInfo &player, Command &activeCommand
 			}
 			else
 			{
-				auto ships = GetShipsList(ship, true);
+				auto ships = ShipsList(ship, true);
 				options.reserve(ships.size());
 				// The current target is not considered by GetShipsList.
 				if(target)
@@ -3896,7 +4139,7 @@ void AI::MovePlayer(Ship &ship, const PlayerInfo &player, Command &activeCommand
 						options.emplace_back(enemy, strategy(*enemy));
 				if(options.empty())
 				{
-					ships = GetShipsList(ship, false);
+					ships = ShipsList(ship, false);
 					options.reserve(ships.size());
 					for(auto &&ally : ships)
 						if(CanBoard(ship, *ally))
@@ -4121,7 +4364,7 @@ void AI::MovePlayer(Ship &ship, const PlayerInfo &player, Command &activeCommand
 			command.SetTurn(activeCommands.Has(Command::RIGHT) - activeCommands.Has(Command::LEFT));
 		if(activeCommands.Has(Command::BACK))
 		{
-			if(!activeCommands.Has(Command::FORWARD) && ship.Attributes().Get("reverse thrust"))
+			if(!activeCommands.Has(Command::FORWARD) && ship.Attributes().Get(REVERSE_THRUST))
 				command |= Command::BACK;
 			else if(!activeCommands.Has(Command::RIGHT | Command::LEFT | Command::AUTOSTEER))
 				command.SetTurn(TurnBackward(ship));
@@ -4288,15 +4531,14 @@ void AI::MovePlayer(Ship &ship, const PlayerInfo &player, Command &activeCommand
 
 bool AI::Has(const Ship &ship, const weak_ptr<const Ship> &other, int type) const
 {
-	auto sit = actions.find(ship.shared_from_this());
-	if(sit == actions.end())
-		return false;
-
-	auto oit = sit->second.find(other);
-	if(oit == sit->second.end())
+	const ShipState *state = FindState(ship);
+	if(!state)
 		return false;
 
-	return (oit->second & type);
+	for(const auto &it : state->actions)
+		if(IsSameShip(it.first, other))
+			return (it.second & type);
+	return false;
 }
 
 
@@ -4320,15 +4562,14 @@ bool AI::Has(const Government *government, const weak_ptr<const Ship> &other, in
 // example, if the player boarded any ship belonging to that government.
 bool AI::Has(const Ship &ship, const Government *government, int type) const
 {
-	auto sit = notoriety.find(ship.shared_from_this());
-	if(sit == notoriety.end())
-		return false;
-
-	auto git = sit->second.find(government);
-	if(git == sit->second.end())
+	const ShipState *state = FindState(ship);
+	if(!state)
 		return false;
 
-	return (git->second & type);
+	for(const auto &it : state->notoriety)
+		if(it.first == government)
+			return (it.second & type);
+	return false;
 }
 
 
@@ -4337,10 +4578,10 @@ void AI::UpdateStrengths(map<const Government *, int64_t> &strength, const Syste
 {
 	// Tally the strength of a government by the strength of its present and able ships.
 	governmentRosters.clear();
-	for(const auto &it : ships)
+	for(Ship *it : registry.Ships())
 		if(it->GetGovernment() && it->GetSystem() == playerSystem)
 		{
-			governmentRosters[it->GetGovernment()].emplace_back(it.get());
+			governmentRosters[it->GetGovernment()].emplace_back(it);
 			if(!it->IsDisabled())
 				strength[it->GetGovernment()] += it->Strength();
 		}
@@ -4348,26 +4589,54 @@ void AI::UpdateStrengths(map<const Government *, int64_t> &strength, const Syste
 	// Strengths of enemies and allies are rebuilt every step.
 	enemyStrength.clear();
 	allyStrength.clear();
-	for(const auto &gov : strength)
+
+	// Make a table of which of the governments present are enemies. Each row
+	// is a bit set of the governments that are enemies of that government.
+	FrameVector<const Government *> governments{FrameAllocator<const Government *>(frameArena)};
+	FrameVector<int64_t> strengths{FrameAllocator<int64_t>(frameArena)};
+	for(const auto &it : strength)
 	{
-		set<const Government *> allies;
-		for(const auto &enemy : strength)
-			if(enemy.first->IsEnemy(gov.first))
+		governments.push_back(it.first);
+		strengths.push_back(it.second);
+	}
+	const size_t count = governments.size();
+	const size_t words = (count + 63) / 64;
+	FrameVector<uint64_t> enemies(count * words, 0, FrameAllocator<uint64_t>(frameArena));
+	for(size_t i = 0; i < count; ++i)
+		for(size_t j = 0; j < count; ++j)
+			if(governments[j]->IsEnemy(governments[i]))
+				enemies[i * words + j / 64] |= uint64_t(1) << (j % 64);
+
+	FrameVector<uint64_t> allies(words, 0, FrameAllocator<uint64_t>(frameArena));
+	for(size_t i = 0; i < count; ++i)
+	{
+		const uint64_t *row = &enemies[i * words];
+		fill(allies.begin(), allies.end(), 0);
+		bool hasEnemies = false;
+		for(size_t j = 0; j < count; ++j)
+			if(row[j / 64] & (uint64_t(1) << (j % 64)))
 			{
 				// "Know your enemies."
-				enemyStrength[gov.first] += enemy.second;
-				for(const auto &ally : strength)
-					if(ally.first->IsEnemy(enemy.first) && !allies.count(ally.first))
-					{
-						// "The enemy of my enemy is my friend."
-						allyStrength[gov.first] += ally.second;
-						allies.insert(ally.first);
-					}
+				enemyStrength[governments[i]] += strengths[j];
+				hasEnemies = true;
+				// "The enemy of my enemy is my friend."
+				for(size_t w = 0; w < words; ++w)
+					allies[w] |= enemies[j * words + w];
 			}
+		if(!hasEnemies)
+			continue;
+
+		int64_t &allyTotal = allyStrength[governments[i]];
+		for(size_t k = 0; k < count; ++k)
+			if(allies[k / 64] & (uint64_t(1) << (k % 64)))
+				allyTotal += strengths[k];
 	}
 
+	IndexRosters();
+
 	// Ships with nearby allies consider their allies' strength as well as their own.
-	for(const auto &it : ships)
+	vector<Body *> &nearby = nearbyShips;
+	for(const Ship *it : registry.Ships())
 	{
 		const Government *gov = it->GetGovernment();
 
@@ -4379,15 +4648,15 @@ void AI::UpdateStrengths(map<const Government *, int64_t> &strength, const Syste
 		if(!gov || it->GetSystem() != playerSystem || it->IsDisabled() || Random::Int(60))
 			continue;
 
-		int64_t &myStrength = shipStrength[it.get()];
-		for(const auto &allies : governmentRosters)
+		int64_t &myStrength = State(*it).strength;
+		rosterSet.Circle(it->Position(), 2000., nearby);
+		for(Body *body : nearby)
 		{
+			const Ship *ally = reinterpret_cast<Ship *>(body);
 			// If this is not an allied government, its ships will not assist this ship when attacked.
-			if(allies.first->AttitudeToward(gov) <= 0.)
-				continue;
-			for(const auto &ally : allies.second)
-				if(!ally->IsDisabled() && ally->Position().Distance(it->Position()) < 2000.)
-					myStrength += ally->Strength();
+			if(ally->GetGovernment()->AttitudeToward(gov) > 0. && !ally->IsDisabled()
+					&& ally->Position().Distance(it->Position()) < 2000.)
+				myStrength += ally->Strength();
 		}
 	}
 }
@@ -4395,6 +4664,47 @@ void AI::UpdateStrengths(map<const Government *, int64_t> &strength, const Syste
 
 
 // Cache various lists of all targetable ships in the player's system for this Step.
+// Put all the ships in the player's system into a spatial index, so that
+// ships can find the others near them without checking every ship there.
+void AI::IndexRosters()
+{
+	// This set is not used for collisions, so it is given a negative step to
+	// leave the ships' animation frames alone.
+	rosterSet.Clear(-1);
+	maxRosterSpeed = 0.;
+	minTargetBonus = 0.;
+	int index = 0;
+	for(const auto &it : governmentRosters)
+		for(Ship *ship : it.second)
+		{
+			rosterSet.Add(*ship);
+			size_t slot = ship->RegistryHandle().index;
+			if(slot >= rosterIndices.size())
+				rosterIndices.resize(slot + 1);
+			rosterIndices[slot] = index++;
+
+			maxRosterSpeed = max(maxRosterSpeed, ship->Velocity().Length());
+			// Keep track of how much closer than it really is FindTarget()
+			// may consider any ship to be, because of its condition or its
+			// past actions.
+			double bonus = min(0., 500. * (ship->Shields() + ship->Hull()));
+			if(ship->IsOverheated())
+				bonus += min(0., 3000. * (ship->Heat() - .9));
+			const ShipState *state = FindState(*ship);
+			if(state)
+				for(const auto &notoriety : state->notoriety)
+					if(notoriety.second & ShipEvent::BOARD)
+					{
+						bonus -= 1000.;
+						break;
+					}
+			minTargetBonus = min(minTargetBonus, bonus);
+		}
+	rosterSet.Finish();
+}
+
+
+
 void AI::CacheShipLists()
 {
 	allyLists.clear();
@@ -4486,9 +4796,15 @@ void AI::IssueOrders(const PlayerInfo &player, const Orders &newOrders, const st
 				continue;
 
 			gaveOrder = true;
-			hasMismatch |= !orders.count(ship);
+			ShipState &state = State(*ship);
+			hasMismatch |= !state.hasOrders;
+			if(!state.hasOrders)
+			{
+				state.hasOrders = true;
+				state.orders = Orders();
+			}
 
-			Orders &existing = orders[ship];
+			Orders &existing = state.orders;
 			// HOLD_ACTIVE cannot be given as manual order, but we make sure here
 			// that any HOLD_ACTIVE order also matches when an HOLD_POSITION
 			// command is given.
@@ -4539,7 +4855,11 @@ void AI::IssueOrders(const PlayerInfo &player, const Orders &newOrders, const st
 			Messages::Add(who + "no longer " + description, Messages::Importance::High);
 
 		for(const Ship *ship : ships)
-			orders.erase(ship);
+		{
+			ShipState *state = FindState(*ship);
+			if(state)
+				state->hasOrders = false;
+		}
 	}
 }
 
@@ -4549,11 +4869,11 @@ void AI::IssueOrders(const PlayerInfo &player, const Orders &newOrders, const st
 void AI::UpdateOrders(const Ship &ship)
 {
 	// This should only be called for ships with orders that can be carried out.
-	auto it = orders.find(&ship);
-	if(it == orders.end())
+	Orders *it = FindOrders(ship);
+	if(!it)
 		return;
 
-	Orders &order = it->second;
+	Orders &order = *it;
 	if((order.type == Orders::MOVE_TO || order.type == Orders::HOLD_ACTIVE) && ship.GetSystem() == order.targetSystem)
 	{
 		// If nearly stopped on the desired point, switch to a HOLD_POSITION order.
@@ -4568,3 +4888,153 @@ void AI::UpdateOrders(const Ship &ship)
 		order.targetSystem = ship.GetSystem();
 	}
 }
+
+
+
+void AI::ShipState::Clean()
+{
+	actions.clear();
+	notoriety.clear();
+	playerActions = 0;
+	swarmCount = 0;
+	fenceCount = -1;
+	hasMiningAngle = false;
+	miningRadius = 0.;
+	miningTime = 0;
+	appeasementThreshold = 0.;
+	strength = 0;
+	retargetNow = false;
+}
+
+
+
+void AI::ShipState::ClearOrders()
+{
+	hasOrders = false;
+	orders = Orders();
+	hasHelper = false;
+	helper.reset();
+}
+
+
+
+AI::ShipState &AI::State(const Ship &ship)
+{
+	ShipState *state = nullptr;
+	ShipRegistry::Handle handle = ship.RegistryHandle();
+	if(registry.Get(handle) == &ship)
+	{
+		if(handle.index >= shipStates.size())
+			shipStates.resize(handle.index + 1);
+		state = &shipStates[handle.index];
+		if(state->ship == &ship)
+			return *state;
+	}
+	else
+	{
+		state = FindState(ship);
+		if(state)
+			return *state;
+		unlistedStates.emplace_back();
+		state = &unlistedStates.back();
+	}
+
+	*state = ShipState();
+	state->owner = ship.shared_from_this();
+	state->ship = &ship;
+	return *state;
+}
+
+
+
+AI::ShipState *AI::FindState(const Ship &ship)
+{
+	// A ship that is in the list has its state in its own slot.
+	ShipRegistry::Handle handle = ship.RegistryHandle();
+	if(registry.Get(handle) == &ship)
+		return (handle.index < shipStates.size() && shipStates[handle.index].ship == &ship)
+			? &shipStates[handle.index] : nullptr;
+
+	// A state whose owner no longer exists belongs to an earlier ship that
+	// happened to have the same address.
+	for(ShipState &state : unlistedStates)
+		if(state.ship == &ship && !state.owner.expired())
+			return &state;
+	return nullptr;
+}
+
+
+
+const AI::ShipState *AI::FindState(const Ship &ship) const
+{
+	ShipRegistry::Handle handle = ship.RegistryHandle();
+	if(registry.Get(handle) == &ship)
+		return (handle.index < shipStates.size() && shipStates[handle.index].ship == &ship)
+			? &shipStates[handle.index] : nullptr;
+
+	for(const ShipState &state : unlistedStates)
+		if(state.ship == &ship && !state.owner.expired())
+			return &state;
+	return nullptr;
+}
+
+
+
+AI::Orders *AI::FindOrders(const Ship &ship)
+{
+	ShipState *state = FindState(ship);
+	return (state && state->hasOrders) ? &state->orders : nullptr;
+}
+
+
+
+const AI::Orders *AI::FindOrders(const Ship &ship) const
+{
+	const ShipState *state = FindState(ship);
+	return (state && state->hasOrders) ? &state->orders : nullptr;
+}
+
+
+
+void AI::RemoveStates()
+{
+	// Set aside the states of ships that have left the list, in case they come
+	// back (e.g. fighters that were carried).
+	for(ShipState &state : shipStates)
+	{
+		if(!state.ship || (!state.owner.expired() && registry.Get(state.ship->RegistryHandle()) == state.ship))
+			continue;
+		if(!state.owner.expired())
+			unlistedStates.emplace_back(std::move(state));
+		state = ShipState();
+	}
+
+	// Give the ships that are back in the list their states again, and forget
+	// about any ships that no longer exist.
+	for(auto it = unlistedStates.begin(); it != unlistedStates.end(); )
+	{
+		if(it->owner.expired())
+		{
+			it = unlistedStates.erase(it);
+			continue;
+		}
+		ShipRegistry::Handle handle = it->ship->RegistryHandle();
+		if(registry.Get(handle) == it->ship)
+		{
+			if(handle.index >= shipStates.size())
+				shipStates.resize(handle.index + 1);
+			shipStates[handle.index] = std::move(*it);
+			it = unlistedStates.erase(it);
+		}
+		else
+			++it;
+	}
+}
+
+
+
+Ship *AI::TargetShip(const Ship &ship) const
+{
+	Ship *target = registry.Get(ship.TargetShipHandle());
+	return target ? target : ship.GetTargetShip().get();
+}
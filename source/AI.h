@@ -16,27 +16,34 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #ifndef ES_AI_H_
 #define ES_AI_H_
 
+#include "Angle.h"
+#include "CollisionSet.h"
 #include "Command.h"
 #include "FireCommand.h"
+#include "FrameArena.h"
 #include "Point.h"
+#include "ShipRegistry.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <list>
 #include <map>
 #include <memory>
+#include <utility>
 #include <vector>
 
-class Angle;
 class AsteroidField;
 class Body;
 class Flotsam;
 class Government;
+class Mask;
 class Minable;
 class PlayerInfo;
 class Ship;
 class ShipEvent;
 class StellarObject;
 class System;
+class WorkerPool;
 
 
 
@@ -52,7 +59,8 @@ public:
 template <class Type>
 	using List = std::list<std::shared_ptr<Type>>;
 	// Constructor, giving the AI access to various object lists.
-	AI(const List<Ship> &ships, const List<Minable> &minables, const List<Flotsam> &flotsam);
+	AI(const List<Ship> &ships, const List<Minable> &minables, const List<Flotsam> &flotsam, WorkerPool &workers,
+		FrameArena &frameArena);
 
 	// Fleet commands from the player.
 	void IssueShipTarget(const PlayerInfo &player, const std::shared_ptr<Ship> &target);
@@ -62,7 +70,7 @@ template <class Type>
 	void UpdateKeys(PlayerInfo &player, Command &clickCommands);
 
 	// Allow the AI to track any events it is interested in.
-	void UpdateEvents(const std::list<ShipEvent> &events);
+	void UpdateEvents(const std::vector<ShipEvent> &events);
 	// Reset the AI's memory of events.
 	void Clean();
 	// Clear ship orders. This should be done when the player lands on a planet,
@@ -78,6 +86,11 @@ template <class Type>
 	int64_t AllyStrength(const Government *government);
 	int64_t EnemyStrength(const Government *government);
 
+	// Obtain a list of the ships in the player's system that match the desired
+	// hostility, optionally only those within the given range. The lists are
+	// built by Step(), so they are only valid until the list of ships changes.
+	std::vector<Ship *> GetShipsList(const Ship &ship, bool targetEnemies, double maxRange = -1.) const;
+
 	// Find nearest landing location.
 	static const StellarObject *FindLandingLocation(const Ship &ship, const bool refuel = true);
 
@@ -85,6 +98,11 @@ template <class Type>
 private:
 	// Check if a ship can pursue its target (i.e. beyond the "fence").
 	bool CanPursue(const Ship &ship, const Ship &target) const;
+	bool HasLeftFence(const Ship &ship) const;
+	bool IsDecisionTurn(const Ship &ship) const;
+	// The same list as GetShipsList(), but allocated from the frame arena, so
+	// it must not be kept past the end of the current step.
+	FrameVector<Ship *> ShipsList(const Ship &ship, bool targetEnemies, double maxRange = -1.) const;
 	// Disabled or stranded ships coordinate with other ships to get assistance.
 	void AskForHelp(Ship &ship, bool &isStranded, const Ship *flagship);
 	bool CanHelp(const Ship &ship, const Ship &helper, const bool needsFuel) const;
@@ -92,8 +110,6 @@ private:
 	// Pick a new target for the given ship.
 	std::shared_ptr<Ship> FindTarget(const Ship &ship) const;
 	std::shared_ptr<Ship> FindNonHostileTarget(const Ship &ship) const;
-	// Obtain a list of ships matching the desired hostility.
-	std::vector<Ship *> GetShipsList(const Ship &ship, bool targetEnemies, double maxRange = -1.) const;
 
 	bool FollowOrders(Ship &ship, Command &command) const;
 	void MoveIndependent(Ship &ship, Command &command) const;
@@ -147,6 +163,23 @@ private:
 	void AutoFire(const Ship &ship, FireCommand &command, bool secondary = true, bool isFlagship = false) const;
 	void AutoFire(const Ship &ship, FireCommand &command, const Body &target) const;
 
+	// Aiming and firing is split into two parts. First, each ship's targets are
+	// gathered while everything they depend on is still in the same state as when
+	// the ship decided on its orders. Then, the aim and fire commands are calculated
+	// from those targets, which only involves the ship's own weapons, so it can be
+	// done for every ship at once, in parallel.
+	class FireControl;
+	void FindTurretTargets(const Ship &ship, FireCommand &command, bool opportunistic,
+		std::vector<const Body *> &targets) const;
+	void FindFireTargets(const Ship &ship, bool secondary, bool isFlagship, FireControl &control) const;
+	static void AimTurrets(const Ship &ship, const std::vector<const Body *> &targets, FireCommand &command);
+	static void AutoFire(const Ship &ship, const FireControl &control, FireCommand &command);
+	// Reserve the fire control entry for the given ship, reusing earlier storage.
+	FireControl &NextFireControl(Ship &ship);
+	// Hand the firing commands over to the ship, or if some of them are still
+	// to be calculated, to its fire control entry.
+	void CommitFiring(Ship &ship, FireControl *control);
+
 	// Calculate how long it will take a projectile to reach a target given the
 	// target's relative position and velocity and the velocity of the
 	// projectile. If it cannot hit the target, this returns NaN.
@@ -165,6 +198,7 @@ private:
 
 	// Functions to classify ships based on government and system.
 	void UpdateStrengths(std::map<const Government *, int64_t> &strength, const System *playerSystem);
+	void IndexRosters();
 	void CacheShipLists();
 
 
@@ -197,11 +231,96 @@ private:
 		const System *targetSystem = nullptr;
 	};
 
+	// Everything that a ship's aiming and firing depends on, as it was when the
+	// ship decided on its orders for this step.
+	class FireControl {
+	public:
+		Ship *ship = nullptr;
+		// Bodies the turrets should consider aiming at.
+		std::vector<const Body *> turretTargets;
+
+		bool autoFire = false;
+		bool secondary = true;
+		bool isFlagship = false;
+		bool beFrugal = false;
+		bool isWaitingToJump = false;
+		// The target for homing weapons, and whether they should hold fire on it.
+		const Ship *homingTarget = nullptr;
+		bool holdHomingFire = false;
+		bool homingTargetIsJumping = false;
+		// Targets for non-homing weapons, along with their collision masks.
+		std::vector<std::pair<const Ship *, const Mask *>> enemies;
+
+		// The firing commands, once the ship is done deciding what to do.
+		bool commit = false;
+		FireCommand command;
+	};
+
+	// Everything the AI remembers about one ship. Rather than keeping a separate
+	// map for each kind of information, each ship that the AI needs to remember
+	// something about has its state in a flat array, in the ship's registry slot.
+	class ShipState {
+	public:
+		// Forget everything that only applies to the current system.
+		void Clean();
+		// Forget the player's orders to this ship, and its request for help.
+		void ClearOrders();
+
+	public:
+		// The ship this state belongs to. If the ship no longer exists, the
+		// state is forgotten.
+		std::weak_ptr<const Ship> owner;
+		const Ship *ship = nullptr;
+
+		// Current orders, for the player's ships.
+		bool hasOrders = false;
+		Orders orders;
+		// The ship that was asked to help this one, if any.
+		bool hasHelper = false;
+		std::weak_ptr<Ship> helper;
+
+		// What this ship has done to other ships, and to governments.
+		std::vector<std::pair<std::weak_ptr<const Ship>, int>> actions;
+		std::vector<std::pair<const Government *, int>> notoriety;
+		// What the player has done to this ship.
+		int playerActions = 0;
+
+		int swarmCount = 0;
+		// How long this ship has been outside the "invisible fence," or -1 if
+		// it has not been outside it recently.
+		int fenceCount = -1;
+		bool hasMiningAngle = false;
+		Angle miningAngle;
+		double miningRadius = 0.;
+		int miningTime = 0;
+		double appeasementThreshold = 0.;
+		int64_t strength = 0;
+		// Whether this ship should reconsider its target without waiting its turn.
+		bool retargetNow = false;
+	};
+
 
 private:
 	void IssueOrders(const PlayerInfo &player, const Orders &newOrders, const std::string &description);
 	// Convert order types based on fulfillment status.
 	void UpdateOrders(const Ship &ship);
+	// Get rid of the given ship's orders if they are no longer valid.
+	void RemoveInvalidOrders(ShipState &state, const Ship &flagship);
+
+	// Get the state for the given ship, creating it if it does not have one.
+	ShipState &State(const Ship &ship);
+	// Get the state for the given ship, or null if it does not have one yet.
+	ShipState *FindState(const Ship &ship);
+	const ShipState *FindState(const Ship &ship) const;
+	// Get the player's current orders to the given ship, if it has any.
+	Orders *FindOrders(const Ship &ship);
+	const Orders *FindOrders(const Ship &ship) const;
+	// Move the states to the registry slots of their ships, and forget about
+	// ships that no longer exist. This must be done after each registry update.
+	void RemoveStates();
+	// Get the given ship's target. If the target is registered, this avoids
+	// locking the ship's pointer to it.
+	Ship *TargetShip(const Ship &ship) const;
 
 
 private:
@@ -209,10 +328,16 @@ private:
 	const List<Ship> &ships;
 	const List<Minable> &minables;
 	const List<Flotsam> &flotsam;
+	// The same ships, in the same order, with handles that can be looked up
+	// without touching their reference counts. Updated at the start of each step.
+	ShipRegistry registry;
 
 	// The current step count for the AI, ranging from 0 to 30. Its value
 	// helps limit how often certain actions occur (such as changing targets).
 	int step = 0;
+	// Ships take turns reconsidering their targets, once in this many steps.
+	size_t decisionStep = 0;
+	size_t decisionInterval = 32;
 
 	// Command applied by the player's "autopilot."
 	Command autoPilot;
@@ -222,6 +347,13 @@ private:
 	// thrashing the heap, since we can reuse the storage for
 	// each ship.
 	FireCommand firingCommands;
+	// Aiming and firing state for each ship in the player's system, which is
+	// turned into firing commands in parallel at the end of each step.
+	std::vector<FireControl> fireControl;
+	size_t fireControlCount = 0;
+	WorkerPool &workers;
+	// Memory for temporary lists that are only needed during one step.
+	FrameArena &frameArena;
 
 	bool isCloaking = false;
 
@@ -231,31 +363,30 @@ private:
 	// The minimum speed before landing will consider non-landable objects.
 	const float MIN_LANDING_VELOCITY = 80.;
 
-	// Current orders for the player's ships. Because this map only applies to
-	// player ships, which are never deleted except when landed, it can use
-	// ordinary pointers instead of weak pointers.
-	std::map<const Ship *, Orders> orders;
+	// Per-ship state, indexed by registry slot, and the states of any ships
+	// that are not in the list of ships (e.g. because they are being carried).
+	std::vector<ShipState> shipStates;
+	std::vector<ShipState> unlistedStates;
 
-	// Records of what various AI ships and factions have done.
+	// Records of what various factions have done.
 	typedef std::owner_less<std::weak_ptr<const Ship>> Comp;
-	std::map<std::weak_ptr<const Ship>, std::map<std::weak_ptr<const Ship>, int, Comp>, Comp> actions;
-	std::map<std::weak_ptr<const Ship>, std::map<const Government *, int>, Comp> notoriety;
 	std::map<const Government *, std::map<std::weak_ptr<const Ship>, int, Comp>> governmentActions;
 	std::map<const Government *, bool> scanPermissions;
-	std::map<std::weak_ptr<const Ship>, int, Comp> playerActions;
-	std::map<const Ship *, std::weak_ptr<Ship>> helperList;
-	std::map<const Ship *, int> swarmCount;
-	std::map<const Ship *, int> fenceCount;
-	std::map<const Ship *, Angle> miningAngle;
-	std::map<const Ship *, double> miningRadius;
-	std::map<const Ship *, int> miningTime;
-	std::map<const Ship *, double> appeasementThreshold;
-
-	std::map<const Ship *, int64_t> shipStrength;
 
 	std::map<const Government *, int64_t> enemyStrength;
 	std::map<const Government *, int64_t> allyStrength;
 	std::map<const Government *, std::vector<Ship *>> governmentRosters;
+	// All the ships in the player's system, for finding the ships near each one.
+	CollisionSet rosterSet;
+	// The results of searching that set. This is a data member so that its
+	// storage can be reused from one search to the next.
+	mutable std::vector<Body *> nearbyShips;
+	// Where each of those ships appears in the cached lists, by registry slot.
+	std::vector<int> rosterIndices;
+	// The highest speed of any of those ships, and the most that FindTarget()
+	// can lower any of their scores by, this step.
+	double maxRosterSpeed = 0.;
+	double minTargetBonus = 0.;
 	std::map<const Government *, std::vector<Ship *>> enemyLists;
 	std::map<const Government *, std::vector<Ship *>> allyLists;
 };
@@ -33,6 +33,11 @@ namespace {
 	constexpr double WRAP = 4096.;
 	constexpr unsigned CELL_SIZE = 256u;
 	constexpr unsigned CELL_COUNT = WRAP / CELL_SIZE;
+
+	// How far the ordinary asteroids may move before their collision set is
+	// rebuilt, and the most steps that it can go without being rebuilt.
+	constexpr double MAX_DRIFT = CELL_SIZE / 4.;
+	constexpr int MAX_REBUILD_INTERVAL = 120;
 }
 
 
@@ -50,6 +55,7 @@ void AsteroidField::Clear()
 {
 	asteroids.clear();
 	minables.clear();
+	stepsUntilRebuild = 0;
 }
 
 
@@ -60,6 +66,7 @@ void AsteroidField::Add(const string &name, int count, double energy)
 	const Sprite *sprite = SpriteSet::Get("asteroid/" + name + "/spin");
 	for(int i = 0; i < count; ++i)
 		asteroids.emplace_back(sprite, energy);
+	stepsUntilRebuild = 0;
 }
 
 
@@ -83,13 +90,16 @@ void AsteroidField::Add(const Minable *minable, int count, double energy, const
 // Move all the asteroids forward one step.
 void AsteroidField::Step(vector<Visual> &visuals, list<shared_ptr<Flotsam>> &flotsam, int step)
 {
-	asteroidCollisions.Clear(step);
+	if(stepsUntilRebuild <= 0)
+		RebuildAsteroidCollisions();
+	--stepsUntilRebuild;
 	for(Asteroid &asteroid : asteroids)
 	{
-		asteroidCollisions.Add(asteroid);
+		// Update the animation frame now, so that collision checks only need
+		// to read it.
+		asteroid.GetFrame(step);
 		asteroid.Step();
 	}
-	asteroidCollisions.Finish();
 
 	// Step through the minables. Since they are destructible, we may need to
 	// remove them from the list.
@@ -122,7 +132,7 @@ void AsteroidField::Draw(DrawList &draw, const Point &center, double zoom) const
 
 
 // Check if the given projectile collides with any asteroids.
-Body *AsteroidField::Collide(const Projectile &projectile, double *closestHit)
+Body *AsteroidField::Collide(const Projectile &projectile, double *closestHit, Minable **hitMinable) const
 {
 	Body *hit = nullptr;
 
@@ -140,11 +150,17 @@ Body *AsteroidField::Collide(const Projectile &projectile, double *closestHit)
 	// The projectile's bounding rectangle now overlaps the wrap square. If it
 	// extends outside that square, it does so only on the low end (assuming no
 	// projectile has a length longer than the wrap distance). If it does extend
-	// outside the square, it must be "tiled" once in that direction.
-	int tileX = 1 + (minimum.X() < grid.X());
-	int tileY = 1 + (minimum.Y() < grid.Y());
-	for(int y = 0; y < tileY; ++y)
-		for(int x = 0; x < tileX; ++x)
+	// outside the square, it must be "tiled" once in that direction. Asteroids
+	// may also have drifted a little way outside the square since the collision
+	// set was built, so tile in any direction the projectile comes that close to.
+	Point low = minimum - grid;
+	Point high = maximum - grid;
+	int firstX = -(high.X() >= WRAP - margin);
+	int firstY = -(high.Y() >= WRAP - margin);
+	int lastX = (low.X() < margin);
+	int lastY = (low.Y() < margin);
+	for(int y = firstY; y <= lastY; ++y)
+		for(int x = firstX; x <= lastX; ++x)
 		{
 			Point offset = Point(x, y) * WRAP;
 			Body *body = asteroidCollisions.Line(from + offset, to + offset, closestHit);
@@ -160,7 +176,7 @@ Body *AsteroidField::Collide(const Projectile &projectile, double *closestHit)
 	if(body)
 	{
 		hit = body;
-		reinterpret_cast<Minable *>(body)->TakeDamage(projectile);
+		*hitMinable = reinterpret_cast<Minable *>(body);
 	}
 	return hit;
 }
@@ -175,6 +191,30 @@ const list<shared_ptr<Minable>> &AsteroidField::Minables() const
 
 
 
+void AsteroidField::RebuildAsteroidCollisions()
+{
+	double maxSpeed = 0.;
+	for(Asteroid &asteroid : asteroids)
+	{
+		asteroid.Wrap();
+		maxSpeed = max(maxSpeed, asteroid.Velocity().Length());
+	}
+	int interval = MAX_REBUILD_INTERVAL;
+	if(maxSpeed * interval > MAX_DRIFT)
+		interval = max(1, static_cast<int>(MAX_DRIFT / maxSpeed));
+	margin = maxSpeed * interval;
+	stepsUntilRebuild = interval;
+
+	// The asteroids' animation frames are updated every step, so the set is
+	// not given a step; it looks up their masks each time it is queried.
+	asteroidCollisions.Clear(-1);
+	for(Asteroid &asteroid : asteroids)
+		asteroidCollisions.Add(asteroid, margin);
+	asteroidCollisions.Finish();
+}
+
+
+
 // Construct an asteroid with the given sprite and "energy level."
 AsteroidField::Asteroid::Asteroid(const Sprite *sprite, double energy)
 {
@@ -208,8 +248,13 @@ void AsteroidField::Asteroid::Step()
 {
 	angle += spin;
 	position += velocity;
+}
+
 
-	// Keep the position within the wrap square.
+
+// Move the asteroid back into the wrap square.
+void AsteroidField::Asteroid::Wrap()
+{
 	if(position.X() < 0.)
 		position = Point(position.X() + WRAP, position.Y());
 	else if(position.X() >= WRAP)
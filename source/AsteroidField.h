@@ -60,7 +60,9 @@ public:
 	void Draw(DrawList &draw, const Point &center, double zoom) const;
 	// Check if the given projectile has hit any of the asteroids, using the information
 	// in the collision sets. If a collision occurs, returns a pointer to the hit body.
-	Body *Collide(const Projectile &projectile, double *closestHit);
+	// If that is a minable asteroid, it is also returned through hitMinable, and it
+	// is up to the caller to apply the projectile's damage to it.
+	Body *Collide(const Projectile &projectile, double *closestHit, Minable **hitMinable) const;
 
 	// Get the list of minable asteroids.
 	const std::list<std::shared_ptr<Minable>> &Minables() const;
@@ -74,6 +76,8 @@ private:
 		Asteroid(const Sprite *sprite, double energy);
 
 		void Step();
+		// Move the asteroid back into the wrap square.
+		void Wrap();
 		void Draw(DrawList &draw, const Point &center, double zoom) const;
 
 	private:
@@ -82,12 +86,24 @@ private:
 	};
 
 
+private:
+	// Rebuild the collision set for the ordinary asteroids.
+	void RebuildAsteroidCollisions();
+
+
 private:
 	std::vector<Asteroid> asteroids;
 	std::list<std::shared_ptr<Minable>> minables;
 
 	CollisionSet asteroidCollisions;
 	CollisionSet minableCollisions;
+
+	// The ordinary asteroids never change course, so their collision set only
+	// has to be rebuilt once they might have moved out of the cells that they
+	// were added to. Until then, they may drift outside the wrap square by up
+	// to the given margin.
+	int stepsUntilRebuild = 0;
+	double margin = 0.;
 };
 
 
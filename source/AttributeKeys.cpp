@@ -0,0 +1,176 @@
+/* AttributeKeys.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "AttributeKeys.h"
+
+
+
+namespace AttributeKeys {
+	const Dictionary::Key ABSOLUTE_THRESHOLD("absolute threshold");
+	const Dictionary::Key ACTIVE_COOLING("active cooling");
+	const Dictionary::Key AFTERBURNER_BURN("afterburner burn");
+	const Dictionary::Key AFTERBURNER_CORROSION("afterburner corrosion");
+	const Dictionary::Key AFTERBURNER_DISCHARGE("afterburner discharge");
+	const Dictionary::Key AFTERBURNER_DISRUPTION("afterburner disruption");
+	const Dictionary::Key AFTERBURNER_ENERGY("afterburner energy");
+	const Dictionary::Key AFTERBURNER_FUEL("afterburner fuel");
+	const Dictionary::Key AFTERBURNER_HEAT("afterburner heat");
+	const Dictionary::Key AFTERBURNER_HULL("afterburner hull");
+	const Dictionary::Key AFTERBURNER_ION("afterburner ion");
+	const Dictionary::Key AFTERBURNER_LEAKAGE("afterburner leakage");
+	const Dictionary::Key AFTERBURNER_SCRAMBLE("afterburner scramble");
+	const Dictionary::Key AFTERBURNER_SHIELDS("afterburner shields");
+	const Dictionary::Key AFTERBURNER_SLOWING("afterburner slowing");
+	const Dictionary::Key AFTERBURNER_THRUST("afterburner thrust");
+	const Dictionary::Key ASTEROID_SCAN_POWER("asteroid scan power");
+	const Dictionary::Key ATMOSPHERE_SCAN("atmosphere scan");
+	const Dictionary::Key AUTOMATON("automaton");
+	const Dictionary::Key BURN_RESISTANCE("burn resistance");
+	const Dictionary::Key BURN_RESISTANCE_ENERGY("burn resistance energy");
+	const Dictionary::Key BURN_RESISTANCE_FUEL("burn resistance fuel");
+	const Dictionary::Key BURN_RESISTANCE_HEAT("burn resistance heat");
+	const Dictionary::Key CARGO_SCAN_EFFICIENCY("cargo scan efficiency");
+	const Dictionary::Key CARGO_SCAN_POWER("cargo scan power");
+	const Dictionary::Key CARGO_SPACE("cargo space");
+	const Dictionary::Key CLOAK("cloak");
+	const Dictionary::Key CLOAKING_ENERGY("cloaking energy");
+	const Dictionary::Key CLOAKING_FUEL("cloaking fuel");
+	const Dictionary::Key CLOAKING_HEAT("cloaking heat");
+	const Dictionary::Key COOLING("cooling");
+	const Dictionary::Key COOLING_ENERGY("cooling energy");
+	const Dictionary::Key COOLING_INEFFICIENCY("cooling inefficiency");
+	const Dictionary::Key CORROSION_RESISTANCE("corrosion resistance");
+	const Dictionary::Key CORROSION_RESISTANCE_ENERGY("corrosion resistance energy");
+	const Dictionary::Key CORROSION_RESISTANCE_FUEL("corrosion resistance fuel");
+	const Dictionary::Key CORROSION_RESISTANCE_HEAT("corrosion resistance heat");
+	const Dictionary::Key DEPLETED_SHIELD_DELAY("depleted shield delay");
+	const Dictionary::Key DISABLED_REPAIR_DELAY("disabled repair delay");
+	const Dictionary::Key DISCHARGE_RESISTANCE("discharge resistance");
+	const Dictionary::Key DISCHARGE_RESISTANCE_ENERGY("discharge resistance energy");
+	const Dictionary::Key DISCHARGE_RESISTANCE_FUEL("discharge resistance fuel");
+	const Dictionary::Key DISCHARGE_RESISTANCE_HEAT("discharge resistance heat");
+	const Dictionary::Key DISRUPTION_RESISTANCE("disruption resistance");
+	const Dictionary::Key DISRUPTION_RESISTANCE_ENERGY("disruption resistance energy");
+	const Dictionary::Key DISRUPTION_RESISTANCE_FUEL("disruption resistance fuel");
+	const Dictionary::Key DISRUPTION_RESISTANCE_HEAT("disruption resistance heat");
+	const Dictionary::Key DRAG("drag");
+	const Dictionary::Key DRAG_REDUCTION("drag reduction");
+	const Dictionary::Key ENERGY_CAPACITY("energy capacity");
+	const Dictionary::Key ENERGY_CONSUMPTION("energy consumption");
+	const Dictionary::Key ENERGY_GENERATION("energy generation");
+	const Dictionary::Key FUEL_CAPACITY("fuel capacity");
+	const Dictionary::Key FUEL_CONSUMPTION("fuel consumption");
+	const Dictionary::Key FUEL_ENERGY("fuel energy");
+	const Dictionary::Key FUEL_GENERATION("fuel generation");
+	const Dictionary::Key FUEL_HEAT("fuel heat");
+	const Dictionary::Key HEAT_CAPACITY("heat capacity");
+	const Dictionary::Key HEAT_DISSIPATION("heat dissipation");
+	const Dictionary::Key HEAT_GENERATION("heat generation");
+	const Dictionary::Key HULL("hull");
+	const Dictionary::Key HULL_ENERGY("hull energy");
+	const Dictionary::Key HULL_ENERGY_MULTIPLIER("hull energy multiplier");
+	const Dictionary::Key HULL_FUEL("hull fuel");
+	const Dictionary::Key HULL_FUEL_MULTIPLIER("hull fuel multiplier");
+	const Dictionary::Key HULL_HEAT("hull heat");
+	const Dictionary::Key HULL_HEAT_MULTIPLIER("hull heat multiplier");
+	const Dictionary::Key HULL_REPAIR_MULTIPLIER("hull repair multiplier");
+	const Dictionary::Key HULL_REPAIR_RATE("hull repair rate");
+	const Dictionary::Key HULL_THRESHOLD("hull threshold");
+	const Dictionary::Key INERTIA_REDUCTION("inertia reduction");
+	const Dictionary::Key INSCRUTABLE("inscrutable");
+	const Dictionary::Key ION_RESISTANCE("ion resistance");
+	const Dictionary::Key ION_RESISTANCE_ENERGY("ion resistance energy");
+	const Dictionary::Key ION_RESISTANCE_FUEL("ion resistance fuel");
+	const Dictionary::Key ION_RESISTANCE_HEAT("ion resistance heat");
+	const Dictionary::Key JUMP_SPEED("jump speed");
+	const Dictionary::Key LANDING_SPEED("landing speed");
+	const Dictionary::Key LEAK_RESISTANCE("leak resistance");
+	const Dictionary::Key LEAK_RESISTANCE_ENERGY("leak resistance energy");
+	const Dictionary::Key LEAK_RESISTANCE_FUEL("leak resistance fuel");
+	const Dictionary::Key LEAK_RESISTANCE_HEAT("leak resistance heat");
+	const Dictionary::Key OUTFIT_SCAN_EFFICIENCY("outfit scan efficiency");
+	const Dictionary::Key OUTFIT_SCAN_POWER("outfit scan power");
+	const Dictionary::Key OVERHEAT_DAMAGE_RATE("overheat damage rate");
+	const Dictionary::Key OVERHEAT_DAMAGE_THRESHOLD("overheat damage threshold");
+	const Dictionary::Key RAMSCOOP("ramscoop");
+	const Dictionary::Key REPAIR_DELAY("repair delay");
+	const Dictionary::Key REQUIRED_CREW("required crew");
+	const Dictionary::Key REVERSE_THRUST("reverse thrust");
+	const Dictionary::Key REVERSE_THRUSTING_BURN("reverse thrusting burn");
+	const Dictionary::Key REVERSE_THRUSTING_CORROSION("reverse thrusting corrosion");
+	const Dictionary::Key REVERSE_THRUSTING_DISCHARGE("reverse thrusting discharge");
+	const Dictionary::Key REVERSE_THRUSTING_DISRUPTION("reverse thrusting disruption");
+	const Dictionary::Key REVERSE_THRUSTING_ENERGY("reverse thrusting energy");
+	const Dictionary::Key REVERSE_THRUSTING_FUEL("reverse thrusting fuel");
+	const Dictionary::Key REVERSE_THRUSTING_HEAT("reverse thrusting heat");
+	const Dictionary::Key REVERSE_THRUSTING_HULL("reverse thrusting hull");
+	const Dictionary::Key REVERSE_THRUSTING_ION("reverse thrusting ion");
+	const Dictionary::Key REVERSE_THRUSTING_LEAKAGE("reverse thrusting leakage");
+	const Dictionary::Key REVERSE_THRUSTING_SCRAMBLE("reverse thrusting scramble");
+	const Dictionary::Key REVERSE_THRUSTING_SHIELDS("reverse thrusting shields");
+	const Dictionary::Key REVERSE_THRUSTING_SLOWING("reverse thrusting slowing");
+	const Dictionary::Key SCRAMBLE_RESISTANCE("scramble resistance");
+	const Dictionary::Key SCRAMBLE_RESISTANCE_ENERGY("scramble resistance energy");
+	const Dictionary::Key SCRAMBLE_RESISTANCE_FUEL("scramble resistance fuel");
+	const Dictionary::Key SCRAMBLE_RESISTANCE_HEAT("scramble resistance heat");
+	const Dictionary::Key SCRAM_DRIVE("scram drive");
+	const Dictionary::Key SELF_DESTRUCT("self destruct");
+	const Dictionary::Key SHIELDS("shields");
+	const Dictionary::Key SHIELD_DELAY("shield delay");
+	const Dictionary::Key SHIELD_ENERGY("shield energy");
+	const Dictionary::Key SHIELD_ENERGY_MULTIPLIER("shield energy multiplier");
+	const Dictionary::Key SHIELD_FUEL("shield fuel");
+	const Dictionary::Key SHIELD_FUEL_MULTIPLIER("shield fuel multiplier");
+	const Dictionary::Key SHIELD_GENERATION("shield generation");
+	const Dictionary::Key SHIELD_GENERATION_MULTIPLIER("shield generation multiplier");
+	const Dictionary::Key SHIELD_HEAT("shield heat");
+	const Dictionary::Key SHIELD_HEAT_MULTIPLIER("shield heat multiplier");
+	const Dictionary::Key SLOWING_RESISTANCE("slowing resistance");
+	const Dictionary::Key SLOWING_RESISTANCE_ENERGY("slowing resistance energy");
+	const Dictionary::Key SLOWING_RESISTANCE_FUEL("slowing resistance fuel");
+	const Dictionary::Key SLOWING_RESISTANCE_HEAT("slowing resistance heat");
+	const Dictionary::Key SOLAR_COLLECTION("solar collection");
+	const Dictionary::Key SOLAR_HEAT("solar heat");
+	const Dictionary::Key TACTICAL_SCAN_POWER("tactical scan power");
+	const Dictionary::Key THRESHOLD_PERCENTAGE("threshold percentage");
+	const Dictionary::Key THRUST("thrust");
+	const Dictionary::Key THRUSTING_BURN("thrusting burn");
+	const Dictionary::Key THRUSTING_CORROSION("thrusting corrosion");
+	const Dictionary::Key THRUSTING_DISCHARGE("thrusting discharge");
+	const Dictionary::Key THRUSTING_DISRUPTION("thrusting disruption");
+	const Dictionary::Key THRUSTING_ENERGY("thrusting energy");
+	const Dictionary::Key THRUSTING_FUEL("thrusting fuel");
+	const Dictionary::Key THRUSTING_HEAT("thrusting heat");
+	const Dictionary::Key THRUSTING_HULL("thrusting hull");
+	const Dictionary::Key THRUSTING_ION("thrusting ion");
+	const Dictionary::Key THRUSTING_LEAKAGE("thrusting leakage");
+	const Dictionary::Key THRUSTING_SCRAMBLE("thrusting scramble");
+	const Dictionary::Key THRUSTING_SHIELDS("thrusting shields");
+	const Dictionary::Key THRUSTING_SLOWING("thrusting slowing");
+	const Dictionary::Key TURN("turn");
+	const Dictionary::Key TURNING_BURN("turning burn");
+	const Dictionary::Key TURNING_CORROSION("turning corrosion");
+	const Dictionary::Key TURNING_DISCHARGE("turning discharge");
+	const Dictionary::Key TURNING_DISRUPTION("turning disruption");
+	const Dictionary::Key TURNING_ENERGY("turning energy");
+	const Dictionary::Key TURNING_FUEL("turning fuel");
+	const Dictionary::Key TURNING_HEAT("turning heat");
+	const Dictionary::Key TURNING_HULL("turning hull");
+	const Dictionary::Key TURNING_ION("turning ion");
+	const Dictionary::Key TURNING_LEAKAGE("turning leakage");
+	const Dictionary::Key TURNING_SCRAMBLE("turning scramble");
+	const Dictionary::Key TURNING_SHIELDS("turning shields");
+	const Dictionary::Key TURNING_SLOWING("turning slowing");
+}
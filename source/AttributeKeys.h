@@ -0,0 +1,185 @@
+/* AttributeKeys.h
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef ATTRIBUTE_KEYS_H_
+#define ATTRIBUTE_KEYS_H_
+
+#include "Dictionary.h"
+
+
+
+// Keys for the outfit attributes that are looked up every step, so that the
+// names are resolved once instead of on every lookup.
+namespace AttributeKeys {
+	extern const Dictionary::Key ABSOLUTE_THRESHOLD;
+	extern const Dictionary::Key ACTIVE_COOLING;
+	extern const Dictionary::Key AFTERBURNER_BURN;
+	extern const Dictionary::Key AFTERBURNER_CORROSION;
+	extern const Dictionary::Key AFTERBURNER_DISCHARGE;
+	extern const Dictionary::Key AFTERBURNER_DISRUPTION;
+	extern const Dictionary::Key AFTERBURNER_ENERGY;
+	extern const Dictionary::Key AFTERBURNER_FUEL;
+	extern const Dictionary::Key AFTERBURNER_HEAT;
+	extern const Dictionary::Key AFTERBURNER_HULL;
+	extern const Dictionary::Key AFTERBURNER_ION;
+	extern const Dictionary::Key AFTERBURNER_LEAKAGE;
+	extern const Dictionary::Key AFTERBURNER_SCRAMBLE;
+	extern const Dictionary::Key AFTERBURNER_SHIELDS;
+	extern const Dictionary::Key AFTERBURNER_SLOWING;
+	extern const Dictionary::Key AFTERBURNER_THRUST;
+	extern const Dictionary::Key ASTEROID_SCAN_POWER;
+	extern const Dictionary::Key ATMOSPHERE_SCAN;
+	extern const Dictionary::Key AUTOMATON;
+	extern const Dictionary::Key BURN_RESISTANCE;
+	extern const Dictionary::Key BURN_RESISTANCE_ENERGY;
+	extern const Dictionary::Key BURN_RESISTANCE_FUEL;
+	extern const Dictionary::Key BURN_RESISTANCE_HEAT;
+	extern const Dictionary::Key CARGO_SCAN_EFFICIENCY;
+	extern const Dictionary::Key CARGO_SCAN_POWER;
+	extern const Dictionary::Key CARGO_SPACE;
+	extern const Dictionary::Key CLOAK;
+	extern const Dictionary::Key CLOAKING_ENERGY;
+	extern const Dictionary::Key CLOAKING_FUEL;
+	extern const Dictionary::Key CLOAKING_HEAT;
+	extern const Dictionary::Key COOLING;
+	extern const Dictionary::Key COOLING_ENERGY;
+	extern const Dictionary::Key COOLING_INEFFICIENCY;
+	extern const Dictionary::Key CORROSION_RESISTANCE;
+	extern const Dictionary::Key CORROSION_RESISTANCE_ENERGY;
+	extern const Dictionary::Key CORROSION_RESISTANCE_FUEL;
+	extern const Dictionary::Key CORROSION_RESISTANCE_HEAT;
+	extern const Dictionary::Key DEPLETED_SHIELD_DELAY;
+	extern const Dictionary::Key DISABLED_REPAIR_DELAY;
+	extern const Dictionary::Key DISCHARGE_RESISTANCE;
+	extern const Dictionary::Key DISCHARGE_RESISTANCE_ENERGY;
+	extern const Dictionary::Key DISCHARGE_RESISTANCE_FUEL;
+	extern const Dictionary::Key DISCHARGE_RESISTANCE_HEAT;
+	extern const Dictionary::Key DISRUPTION_RESISTANCE;
+	extern const Dictionary::Key DISRUPTION_RESISTANCE_ENERGY;
+	extern const Dictionary::Key DISRUPTION_RESISTANCE_FUEL;
+	extern const Dictionary::Key DISRUPTION_RESISTANCE_HEAT;
+	extern const Dictionary::Key DRAG;
+	extern const Dictionary::Key DRAG_REDUCTION;
+	extern const Dictionary::Key ENERGY_CAPACITY;
+	extern const Dictionary::Key ENERGY_CONSUMPTION;
+	extern const Dictionary::Key ENERGY_GENERATION;
+	extern const Dictionary::Key FUEL_CAPACITY;
+	extern const Dictionary::Key FUEL_CONSUMPTION;
+	extern const Dictionary::Key FUEL_ENERGY;
+	extern const Dictionary::Key FUEL_GENERATION;
+	extern const Dictionary::Key FUEL_HEAT;
+	extern const Dictionary::Key HEAT_CAPACITY;
+	extern const Dictionary::Key HEAT_DISSIPATION;
+	extern const Dictionary::Key HEAT_GENERATION;
+	extern const Dictionary::Key HULL;
+	extern const Dictionary::Key HULL_ENERGY;
+	extern const Dictionary::Key HULL_ENERGY_MULTIPLIER;
+	extern const Dictionary::Key HULL_FUEL;
+	extern const Dictionary::Key HULL_FUEL_MULTIPLIER;
+	extern const Dictionary::Key HULL_HEAT;
+	extern const Dictionary::Key HULL_HEAT_MULTIPLIER;
+	extern const Dictionary::Key HULL_REPAIR_MULTIPLIER;
+	extern const Dictionary::Key HULL_REPAIR_RATE;
+	extern const Dictionary::Key HULL_THRESHOLD;
+	extern const Dictionary::Key INERTIA_REDUCTION;
+	extern const Dictionary::Key INSCRUTABLE;
+	extern const Dictionary::Key ION_RESISTANCE;
+	extern const Dictionary::Key ION_RESISTANCE_ENERGY;
+	extern const Dictionary::Key ION_RESISTANCE_FUEL;
+	extern const Dictionary::Key ION_RESISTANCE_HEAT;
+	extern const Dictionary::Key JUMP_SPEED;
+	extern const Dictionary::Key LANDING_SPEED;
+	extern const Dictionary::Key LEAK_RESISTANCE;
+	extern const Dictionary::Key LEAK_RESISTANCE_ENERGY;
+	extern const Dictionary::Key LEAK_RESISTANCE_FUEL;
+	extern const Dictionary::Key LEAK_RESISTANCE_HEAT;
+	extern const Dictionary::Key OUTFIT_SCAN_EFFICIENCY;
+	extern const Dictionary::Key OUTFIT_SCAN_POWER;
+	extern const Dictionary::Key OVERHEAT_DAMAGE_RATE;
+	extern const Dictionary::Key OVERHEAT_DAMAGE_THRESHOLD;
+	extern const Dictionary::Key RAMSCOOP;
+	extern const Dictionary::Key REPAIR_DELAY;
+	extern const Dictionary::Key REQUIRED_CREW;
+	extern const Dictionary::Key REVERSE_THRUST;
+	extern const Dictionary::Key REVERSE_THRUSTING_BURN;
+	extern const Dictionary::Key REVERSE_THRUSTING_CORROSION;
+	extern const Dictionary::Key REVERSE_THRUSTING_DISCHARGE;
+	extern const Dictionary::Key REVERSE_THRUSTING_DISRUPTION;
+	extern const Dictionary::Key REVERSE_THRUSTING_ENERGY;
+	extern const Dictionary::Key REVERSE_THRUSTING_FUEL;
+	extern const Dictionary::Key REVERSE_THRUSTING_HEAT;
+	extern const Dictionary::Key REVERSE_THRUSTING_HULL;
+	extern const Dictionary::Key REVERSE_THRUSTING_ION;
+	extern const Dictionary::Key REVERSE_THRUSTING_LEAKAGE;
+	extern const Dictionary::Key REVERSE_THRUSTING_SCRAMBLE;
+	extern const Dictionary::Key REVERSE_THRUSTING_SHIELDS;
+	extern const Dictionary::Key REVERSE_THRUSTING_SLOWING;
+	extern const Dictionary::Key SCRAMBLE_RESISTANCE;
+	extern const Dictionary::Key SCRAMBLE_RESISTANCE_ENERGY;
+	extern const Dictionary::Key SCRAMBLE_RESISTANCE_FUEL;
+	extern const Dictionary::Key SCRAMBLE_RESISTANCE_HEAT;
+	extern const Dictionary::Key SCRAM_DRIVE;
+	extern const Dictionary::Key SELF_DESTRUCT;
+	extern const Dictionary::Key SHIELDS;
+	extern const Dictionary::Key SHIELD_DELAY;
+	extern const Dictionary::Key SHIELD_ENERGY;
+	extern const Dictionary::Key SHIELD_ENERGY_MULTIPLIER;
+	extern const Dictionary::Key SHIELD_FUEL;
+	extern const Dictionary::Key SHIELD_FUEL_MULTIPLIER;
+	extern const Dictionary::Key SHIELD_GENERATION;
+	extern const Dictionary::Key SHIELD_GENERATION_MULTIPLIER;
+	extern const Dictionary::Key SHIELD_HEAT;
+	extern const Dictionary::Key SHIELD_HEAT_MULTIPLIER;
+	extern const Dictionary::Key SLOWING_RESISTANCE;
+	extern const Dictionary::Key SLOWING_RESISTANCE_ENERGY;
+	extern const Dictionary::Key SLOWING_RESISTANCE_FUEL;
+	extern const Dictionary::Key SLOWING_RESISTANCE_HEAT;
+	extern const Dictionary::Key SOLAR_COLLECTION;
+	extern const Dictionary::Key SOLAR_HEAT;
+	extern const Dictionary::Key TACTICAL_SCAN_POWER;
+	extern const Dictionary::Key THRESHOLD_PERCENTAGE;
+	extern const Dictionary::Key THRUST;
+	extern const Dictionary::Key THRUSTING_BURN;
+	extern const Dictionary::Key THRUSTING_CORROSION;
+	extern const Dictionary::Key THRUSTING_DISCHARGE;
+	extern const Dictionary::Key THRUSTING_DISRUPTION;
+	extern const Dictionary::Key THRUSTING_ENERGY;
+	extern const Dictionary::Key THRUSTING_FUEL;
+	extern const Dictionary::Key THRUSTING_HEAT;
+	extern const Dictionary::Key THRUSTING_HULL;
+	extern const Dictionary::Key THRUSTING_ION;
+	extern const Dictionary::Key THRUSTING_LEAKAGE;
+	extern const Dictionary::Key THRUSTING_SCRAMBLE;
+	extern const Dictionary::Key THRUSTING_SHIELDS;
+	extern const Dictionary::Key THRUSTING_SLOWING;
+	extern const Dictionary::Key TURN;
+	extern const Dictionary::Key TURNING_BURN;
+	extern const Dictionary::Key TURNING_CORROSION;
+	extern const Dictionary::Key TURNING_DISCHARGE;
+	extern const Dictionary::Key TURNING_DISRUPTION;
+	extern const Dictionary::Key TURNING_ENERGY;
+	extern const Dictionary::Key TURNING_FUEL;
+	extern const Dictionary::Key TURNING_HEAT;
+	extern const Dictionary::Key TURNING_HULL;
+	extern const Dictionary::Key TURNING_ION;
+	extern const Dictionary::Key TURNING_LEAKAGE;
+	extern const Dictionary::Key TURNING_SCRAMBLE;
+	extern const Dictionary::Key TURNING_SHIELDS;
+	extern const Dictionary::Key TURNING_SLOWING;
+}
+
+
+
+#endif
@@ -40,7 +40,21 @@ namespace {
 // Clear the list, also setting the global time step for animation.
 void BatchDrawList::Clear(int step, double zoom)
 {
-	data.clear();
+	// Keep the buffers of any sprites that were drawn since the last time the
+	// list was cleared, since they are likely to be drawn again. This avoids
+	// reallocating them as they fill up each step.
+	for(auto it = data.begin(); it != data.end(); )
+	{
+		if(it->second.empty())
+			it = data.erase(it);
+		else
+		{
+			it->second.clear();
+			++it;
+		}
+	}
+	lastSprite = nullptr;
+	lastData = nullptr;
 	this->step = step;
 	this->zoom = zoom;
 	isHighDPI = (Screen::IsHighResolution() ? zoom > .5 : zoom > 1.);
@@ -87,7 +101,8 @@ void BatchDrawList::Draw() const
 	BatchShader::Bind();
 
 	for(const pair<const Sprite * const, vector<float>> &it : data)
-		BatchShader::Add(it.first, isHighDPI, it.second);
+		if(!it.second.empty())
+			BatchShader::Add(it.first, isHighDPI, it.second);
 
 	BatchShader::Unbind();
 }
@@ -122,8 +137,14 @@ bool BatchDrawList::Add(const Body &body, Point position, float clip)
 	if(Cull(body, position))
 		return false;
 
-	// Get the data vector for this particular sprite.
-	vector<float> &v = data[body.GetSprite()];
+	// Get the data vector for this particular sprite. Objects with the same
+	// sprite are often added one after another, e.g. the particles of an effect.
+	if(body.GetSprite() != lastSprite)
+	{
+		lastSprite = body.GetSprite();
+		lastData = &data[lastSprite];
+	}
+	vector<float> &v = *lastData;
 	// The sprite frame is the same for every vertex.
 	float frame = body.GetFrame(step);
 
@@ -61,6 +61,9 @@ private:
 	// vertices has five attributes: (x, y) position in pixels, (s, t) texture
 	// coordinates, and the index of the sprite frame.
 	std::map<const Sprite *, std::vector<float>> data;
+	// The sprite that was most recently added, and its data vector.
+	const Sprite *lastSprite = nullptr;
+	std::vector<float> *lastData = nullptr;
 };
 
 
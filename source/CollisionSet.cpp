@@ -24,6 +24,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "Ship.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <numeric>
 #include <set>
@@ -37,54 +38,66 @@ namespace {
 	// Velocity used for any projectiles with v > MAX_VELOCITY
 	constexpr int USED_MAX_VELOCITY = MAX_VELOCITY - 1;
 	// Warn the user only once about too-large projectile velocities.
-	bool warned = false;
+	atomic<bool> warned(false);
+
+	// The number of levels in the grid. The cells of each level are this power
+	// of two times as wide as the cells of the level below it.
+	constexpr unsigned LEVELS = 3u;
+	constexpr unsigned LEVEL_SHIFT = 3u;
+
+	// An adaptive set sizes its cells so that this fraction of the objects in
+	// it fit in the finest level, but it never strays more than this power of
+	// two from the cell size it was created with.
+	constexpr double FINE_FRACTION = .9;
+	constexpr unsigned ADAPTIVE_RANGE = 1u;
+}
 
 
-	// Keep track of the closest collision found so far. If an external "closest
-	// hit" value was given, there is no need to check collisions farther out
-	// than that.
-	class Closest {
-	public:
-		Closest(double closestHit)
-			: closest_dist(closestHit)
-			, closest_body(nullptr)
-		{}
 
-		void TryNearer(double new_closest, Body *new_body)
-		{
-			if(new_closest >= closest_dist)
-				return;
+// Keep track of the closest collision found so far. If an external "closest
+// hit" value was given, there is no need to check collisions farther out
+// than that.
+class CollisionSet::Closest {
+public:
+	Closest(double closestHit)
+		: closest_dist(closestHit)
+		, closest_body(nullptr)
+	{}
 
-			closest_dist = new_closest;
-			closest_body = new_body;
-		}
+	void TryNearer(double new_closest, Body *new_body)
+	{
+		if(new_closest >= closest_dist)
+			return;
+
+		closest_dist = new_closest;
+		closest_body = new_body;
+	}
 
-		double GetClosestDistance() const { return closest_dist; }
-		Body *GetClosestBody() const { return closest_body; }
+	double GetClosestDistance() const { return closest_dist; }
+	Body *GetClosestBody() const { return closest_body; }
+
+private:
+	double closest_dist;
+	Body *closest_body;
+};
 
-	private:
-		double closest_dist;
-		Body *closest_body;
-	};
-}
 
 
 // Initialize a collision set. The cell size and cell count should both be
 // powers of two; otherwise, they are rounded down to a power of two.
-CollisionSet::CollisionSet(unsigned cellSize, unsigned cellCount)
+CollisionSet::CollisionSet(unsigned cellSize, unsigned cellCount, bool adaptive)
+	: adaptive(adaptive)
 {
 	// Right shift amount to convert from (x, y) location to grid (x, y).
-	SHIFT = 0u;
+	BASE_SHIFT = 0u;
 	while(cellSize >>= 1u)
-		++SHIFT;
-	CELL_SIZE = (1u << SHIFT);
-	CELL_MASK = CELL_SIZE - 1u;
+		++BASE_SHIFT;
+	nextShift = BASE_SHIFT;
 
 	// Number of grid rows and columns.
-	CELLS = 1u;
+	BASE_CELLS = 1u;
 	while(cellCount >>= 1u)
-		CELLS <<= 1;
-	WRAP_MASK = CELLS - 1u;
+		BASE_CELLS <<= 1;
 
 	// Just in case Clear() isn't called before objects are added:
 	Clear(0);
@@ -97,25 +110,51 @@ void CollisionSet::Clear(int step)
 {
 	this->step = step;
 
+	// Change the number of cells along with their size, so that the grid keeps
+	// covering the same area before it wraps around.
+	SHIFT = nextShift;
+	if(SHIFT <= BASE_SHIFT)
+		CELLS = BASE_CELLS << (BASE_SHIFT - SHIFT);
+	else
+		CELLS = max(1u, BASE_CELLS >> (SHIFT - BASE_SHIFT));
+	WRAP_MASK = CELLS - 1u;
+	usedLevels = 0u;
+
 	added.clear();
 	sorted.clear();
 	counts.clear();
 	all.clear();
 	// The counts vector starts with two sentinel slots that will be used in the
 	// course of performing the radix sort.
-	counts.resize(CELLS * CELLS + 2u, 0u);
+	counts.resize(LEVELS * CELLS * CELLS + 2u, 0u);
 }
 
 
 
-// Add an object to the set.
-void CollisionSet::Add(Body &body)
+// Add an object to the set. If the set will be queried again after the
+// object has moved, give the farthest it may move before the set is rebuilt.
+void CollisionSet::Add(Body &body, double margin)
 {
+	// Put the object in the finest level of the grid whose cells are at least
+	// as wide as it is, so that it covers no more than two cells in each
+	// direction. Only the coarsest level has no limit on the object's size.
+	const double radius = body.Radius() + margin;
+	unsigned level = 0u;
+	while(level + 1u < LEVELS && 2. * radius > static_cast<double>(1u << (SHIFT + level * LEVEL_SHIFT)))
+		++level;
+	const unsigned shift = SHIFT + level * LEVEL_SHIFT;
+	usedLevels |= (1u << level);
+
 	// Calculate the range of (x, y) grid coordinates this object covers.
-	int minX = static_cast<int>(body.Position().X() - body.Radius()) >> SHIFT;
-	int minY = static_cast<int>(body.Position().Y() - body.Radius()) >> SHIFT;
-	int maxX = static_cast<int>(body.Position().X() + body.Radius()) >> SHIFT;
-	int maxY = static_cast<int>(body.Position().Y() + body.Radius()) >> SHIFT;
+	int minX = static_cast<int>(body.Position().X() - radius) >> shift;
+	int minY = static_cast<int>(body.Position().Y() - radius) >> shift;
+	int maxX = static_cast<int>(body.Position().X() + radius) >> shift;
+	int maxY = static_cast<int>(body.Position().Y() + radius) >> shift;
+
+	// Update the object's animation frame for this step now, and look up the
+	// mask for that frame, so that queries only need to read them. Each query
+	// would otherwise look the mask up again.
+	const Mask *mask = (step >= 0 ? &body.GetMask(step) : nullptr);
 
 	// Add a pointer to this object in every grid cell it occupies.
 	for(int y = minY; y <= maxY; ++y)
@@ -124,8 +163,8 @@ void CollisionSet::Add(Body &body)
 		for(int x = minX; x <= maxX; ++x)
 		{
 			auto gx = x & WRAP_MASK;
-			added.emplace_back(&body, all.size(), x, y);
-			++counts[gy * CELLS + gx + 2];
+			added.emplace_back(&body, mask, level, x, y, minX, minY, maxX, maxY);
+			++counts[(level * CELLS + gy) * CELLS + gx + 2];
 		}
 	}
 
@@ -150,16 +189,14 @@ void CollisionSet::Finish()
 	{
 		auto gx = entry.x & WRAP_MASK;
 		auto gy = entry.y & WRAP_MASK;
-		auto index = gy * CELLS + gx + 1;
+		auto index = (entry.level * CELLS + gy) * CELLS + gx + 1;
 
 		sorted[counts[index]++] = entry;
 	}
 	// Now, counts[index] is where a certain bin begins.
 
-	// Initialize 'seen' with 0
-	seen.clear();
-	seen.resize(all.size());
-	seenEpoch = 0;
+	if(adaptive)
+		Resize();
 }
 
 
@@ -184,25 +221,58 @@ Body *CollisionSet::Line(const Projectile &projectile, double *closestHit) const
 Body *CollisionSet::Line(const Point &from, const Point &to, double *closestHit,
 		const Government *pGov, const Body *target) const
 {
+	const Point pVelocity = (to - from);
+	if(pVelocity.Length() > MAX_VELOCITY)
+	{
+		// Cap projectile velocity to prevent integer overflows.
+		if(!warned.exchange(true))
+			Logger::LogError("Warning: maximum projectile velocity is " + to_string(MAX_VELOCITY));
+		Point newEnd = from + pVelocity.Unit() * USED_MAX_VELOCITY;
+
+		return Line(from, newEnd, closestHit, pGov, target);
+	}
+
+	Closest closer_result(closestHit ? *closestHit : 1.);
+	for(unsigned level = 0u; level < LEVELS; ++level)
+		if(usedLevels & (1u << level))
+			Line(level, from, to, pGov, target, closer_result);
+
+	if(closer_result.GetClosestDistance() < 1. && closestHit)
+		*closestHit = closer_result.GetClosestDistance();
+
+	return closer_result.GetClosestBody();
+}
+
+
+
+// Check for collisions with a line in one level of the grid.
+void CollisionSet::Line(unsigned level, const Point &from, const Point &to, const Government *pGov,
+	const Body *target, Closest &closer_result) const
+{
+	const unsigned shift = SHIFT + level * LEVEL_SHIFT;
+	const unsigned cellSize = (1u << shift);
+	const unsigned cellMask = cellSize - 1u;
+	const unsigned levelStart = level * CELLS * CELLS;
+	// Stop once an object in this level is hit.
+	const Body *previous = closer_result.GetClosestBody();
+
 	const int x = from.X();
 	const int y = from.Y();
 	const int endX = to.X();
 	const int endY = to.Y();
 
 	// Figure out which grid cell the line starts and ends in.
-	int gx = x >> SHIFT;
-	int gy = y >> SHIFT;
-	const int endGX = endX >> SHIFT;
-	const int endGY = endY >> SHIFT;
-
-	Closest closer_result(closestHit ? *closestHit : 1.);
+	int gx = x >> shift;
+	int gy = y >> shift;
+	const int endGX = endX >> shift;
+	const int endGY = endY >> shift;
 
 	// Special case, very common: the projectile is contained in one grid cell.
 	// In this case, all the complicated code below can be skipped.
 	if(gx == endGX && gy == endGY)
 	{
 		// Examine all objects in the current grid cell.
-		const auto index = (gy & WRAP_MASK) * CELLS + (gx & WRAP_MASK);
+		const auto index = levelStart + (gy & WRAP_MASK) * CELLS + (gx & WRAP_MASK);
 		vector<Entry>::const_iterator it = sorted.begin() + counts[index];
 		vector<Entry>::const_iterator end = sorted.begin() + counts[index + 1];
 		for( ; it != end; ++it)
@@ -218,30 +288,13 @@ Body *CollisionSet::Line(const Point &from, const Point &to, double *closestHit,
 			if(it->body != target && iGov && pGov && !iGov->IsEnemy(pGov))
 				continue;
 
-			const Mask &mask = it->body->GetMask(step);
+			const Mask &mask = it->GetMask(step);
 			Point offset = from - it->body->Position();
 			const double range = mask.Collide(offset, to - from, it->body->Facing());
 
 			closer_result.TryNearer(range, it->body);
 		}
-		if(closer_result.GetClosestDistance() < 1. && closestHit)
-			*closestHit = closer_result.GetClosestDistance();
-
-		return closer_result.GetClosestBody();
-	}
-
-	const Point pVelocity = (to - from);
-	if(pVelocity.Length() > MAX_VELOCITY)
-	{
-		// Cap projectile velocity to prevent integer overflows.
-		if(!warned)
-		{
-			Logger::LogError("Warning: maximum projectile velocity is " + to_string(MAX_VELOCITY));
-			warned = true;
-		}
-		Point newEnd = from + pVelocity.Unit() * USED_MAX_VELOCITY;
-
-		return Line(from, newEnd, closestHit, pGov, target);
+		return;
 	}
 
 	// When stepping from one grid cell to the next, we'll go in this direction.
@@ -253,24 +306,29 @@ Body *CollisionSet::Line(const Point &from, const Point &to, double *closestHit,
 	// Behave as if each grid cell has this width and height. This guarantees
 	// that we only need to work with integer coordinates.
 	const uint64_t scale = max<uint64_t>(mx, 1) * max<uint64_t>(my, 1);
-	const uint64_t fullScale = CELL_SIZE * scale;
+	const uint64_t fullScale = cellSize * scale;
 
 	// Get the "remainder" distance that we must travel in x and y in order to
 	// reach the next grid cell. These ensure we only check grid cells which the
 	// line will pass through.
-	uint64_t rx = scale * (x & CELL_MASK);
-	uint64_t ry = scale * (y & CELL_MASK);
+	uint64_t rx = scale * (x & cellMask);
+	uint64_t ry = scale * (y & cellMask);
 	if(stepX > 0)
 		rx = fullScale - rx;
 	if(stepY > 0)
 		ry = fullScale - ry;
 
-	++seenEpoch;
+	// The grid cell that was examined before the current one, if any. Because
+	// the line never turns back, an object was already considered if and only
+	// if it also covers that cell.
+	bool hasPrevious = false;
+	int prevX = gx;
+	int prevY = gy;
 
 	while(true)
 	{
 		// Examine all objects in the current grid cell.
-		auto i = (gy & WRAP_MASK) * CELLS + (gx & WRAP_MASK);
+		auto i = levelStart + (gy & WRAP_MASK) * CELLS + (gx & WRAP_MASK);
 		vector<Entry>::const_iterator it = sorted.begin() + counts[i];
 		vector<Entry>::const_iterator end = sorted.begin() + counts[i + 1];
 		for( ; it != end; ++it)
@@ -280,9 +338,9 @@ Body *CollisionSet::Line(const Point &from, const Point &to, double *closestHit,
 			if(it->x != gx || it->y != gy)
 				continue;
 
-			if(seen[it->seenIndex] == seenEpoch)
+			// Skip objects that were already considered in the previous cell.
+			if(hasPrevious && prevX >= it->minX && prevX <= it->maxX && prevY >= it->minY && prevY <= it->maxY)
 				continue;
-			seen[it->seenIndex] = seenEpoch;
 
 			// Check if this projectile can hit this object. If either the
 			// projectile or the object has no government, it will always hit.
@@ -290,7 +348,7 @@ Body *CollisionSet::Line(const Point &from, const Point &to, double *closestHit,
 			if(it->body != target && iGov && pGov && !iGov->IsEnemy(pGov))
 				continue;
 
-			const Mask &mask = it->body->GetMask(step);
+			const Mask &mask = it->GetMask(step);
 			Point offset = from - it->body->Position();
 			const double range = mask.Collide(offset, to - from, it->body->Facing());
 
@@ -298,8 +356,11 @@ Body *CollisionSet::Line(const Point &from, const Point &to, double *closestHit,
 		}
 
 		// Check if we've found a collision or reached the final grid cell.
-		if(closer_result.GetClosestBody() || (gx == endGX && gy == endGY))
+		if(closer_result.GetClosestBody() != previous || (gx == endGX && gy == endGY))
 			break;
+		hasPrevious = true;
+		prevX = gx;
+		prevY = gy;
 		// If not, move to the next one. Check whether rx / mx < ry / my.
 		const int64_t diff = rx * my - ry * mx;
 		if(!diff)
@@ -333,11 +394,6 @@ Body *CollisionSet::Line(const Point &from, const Point &to, double *closestHit,
 			gy += stepY;
 		}
 	}
-
-	if(closer_result.GetClosestDistance() < 1. && closestHit)
-		*closestHit = closer_result.GetClosestDistance();
-
-	return closer_result.GetClosestBody();
 }
 
 
@@ -350,50 +406,70 @@ const vector<Body *> &CollisionSet::Circle(const Point &center, double radius) c
 
 
 
+void CollisionSet::Circle(const Point &center, double radius, vector<Body *> &result) const
+{
+	Ring(center, 0., radius, result);
+}
+
+
+
 // Get all objects touching a ring with a given inner and outer range
 // centered at the given point.
 const vector<Body *> &CollisionSet::Ring(const Point &center, double inner, double outer) const
 {
-	// Calculate the range of (x, y) grid coordinates this ring covers.
-	const int minX = static_cast<int>(center.X() - outer) >> SHIFT;
-	const int minY = static_cast<int>(center.Y() - outer) >> SHIFT;
-	const int maxX = static_cast<int>(center.X() + outer) >> SHIFT;
-	const int maxY = static_cast<int>(center.Y() + outer) >> SHIFT;
+	Ring(center, inner, outer, result);
+	return result;
+}
 
-	++seenEpoch;
 
+
+void CollisionSet::Ring(const Point &center, double inner, double outer, vector<Body *> &result) const
+{
 	result.clear();
-	for(int y = minY; y <= maxY; ++y)
+	for(unsigned level = 0u; level < LEVELS; ++level)
 	{
-		const auto gy = y & WRAP_MASK;
-		for(int x = minX; x <= maxX; ++x)
+		if(!(usedLevels & (1u << level)))
+			continue;
+
+		// Calculate the range of (x, y) grid coordinates this ring covers.
+		const unsigned shift = SHIFT + level * LEVEL_SHIFT;
+		const unsigned levelStart = level * CELLS * CELLS;
+		const int minX = static_cast<int>(center.X() - outer) >> shift;
+		const int minY = static_cast<int>(center.Y() - outer) >> shift;
+		const int maxX = static_cast<int>(center.X() + outer) >> shift;
+		const int maxY = static_cast<int>(center.Y() + outer) >> shift;
+
+		for(int y = minY; y <= maxY; ++y)
 		{
-			const auto gx = x & WRAP_MASK;
-			const auto index = gy * CELLS + gx;
-			vector<Entry>::const_iterator it = sorted.begin() + counts[index];
-			vector<Entry>::const_iterator end = sorted.begin() + counts[index + 1];
-
-			for( ; it != end; ++it)
+			const auto gy = y & WRAP_MASK;
+			for(int x = minX; x <= maxX; ++x)
 			{
-				// Skip objects that were put in this same grid cell only because
-				// of the cell coordinates wrapping around.
-				if(it->x != x || it->y != y)
-					continue;
-
-				if(seen[it->seenIndex] == seenEpoch)
-					continue;
-				seen[it->seenIndex] = seenEpoch;
-
-				const Mask &mask = it->body->GetMask(step);
-				Point offset = center - it->body->Position();
-				const double length = offset.Length();
-				if((length <= outer && length >= inner)
-					|| mask.WithinRing(offset, it->body->Facing(), inner, outer))
-					result.push_back(it->body);
+				const auto gx = x & WRAP_MASK;
+				const auto index = levelStart + gy * CELLS + gx;
+				vector<Entry>::const_iterator it = sorted.begin() + counts[index];
+				vector<Entry>::const_iterator end = sorted.begin() + counts[index + 1];
+
+				for( ; it != end; ++it)
+				{
+					// Skip objects that were put in this same grid cell only because
+					// of the cell coordinates wrapping around.
+					if(it->x != x || it->y != y)
+						continue;
+
+					// An object that covers several of the cells in range is only
+					// considered in the first of them.
+					if(x != max(it->minX, minX) || y != max(it->minY, minY))
+						continue;
+
+					Point offset = center - it->body->Position();
+					const double length = offset.Length();
+					if((length <= outer && length >= inner)
+						|| it->GetMask(step).WithinRing(offset, it->body->Facing(), inner, outer))
+						result.push_back(it->body);
+				}
 			}
 		}
 	}
-	return result;
 }
 
 
@@ -402,3 +478,31 @@ const vector<Body *> &CollisionSet::All() const
 {
 	return all;
 }
+
+
+
+const Mask &CollisionSet::Entry::GetMask(int step) const
+{
+	return mask ? *mask : body->GetMask(step);
+}
+
+
+
+// Choose the cell size for the next step, so that most of the objects in the
+// set fit in the finest level of the grid.
+void CollisionSet::Resize()
+{
+	if(all.empty())
+		return;
+
+	radii.clear();
+	for(const Body *body : all)
+		radii.push_back(body->Radius());
+	auto it = radii.begin() + static_cast<size_t>(FINE_FRACTION * (radii.size() - 1));
+	nth_element(radii.begin(), it, radii.end());
+
+	unsigned shift = (BASE_SHIFT > ADAPTIVE_RANGE ? BASE_SHIFT - ADAPTIVE_RANGE : 0u);
+	while(shift < BASE_SHIFT + ADAPTIVE_RANGE && 2. * *it > static_cast<double>(1u << shift))
+		++shift;
+	nextShift = shift;
+}
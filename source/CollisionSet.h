@@ -19,6 +19,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include <vector>
 
 class Government;
+class Mask;
 class Point;
 class Projectile;
 class Body;
@@ -27,21 +28,32 @@ class Body;
 
 // A CollisionSet allows efficient collision detection by splitting space up
 // into a grid and keeping track of which objects are in each grid cell. A check
-// for collisions can then only examine objects in certain cells.
+// for collisions can then only examine objects in certain cells. Objects that
+// are too big for the grid are stored in a coarser grid instead, so that no
+// object takes up more than a few cells.
 class CollisionSet {
 public:
 	// Initialize a collision set. The cell size and cell count should both be
-	// powers of two; otherwise, they are rounded down to a power of two.
-	CollisionSet(unsigned cellSize, unsigned cellCount);
+	// powers of two; otherwise, they are rounded down to a power of two. An
+	// adaptive set picks a new cell size each time it is cleared, based on the
+	// sizes of the objects it held the last time, but keeps the grid's overall
+	// extent the same.
+	CollisionSet(unsigned cellSize, unsigned cellCount, bool adaptive = false);
 
 	// Clear all objects in the set. Specify which engine step we are on, so we
 	// know what animation frame each object is on.
 	void Clear(int step);
-	// Add an object to the set.
-	void Add(Body &body);
+	// Add an object to the set. If the set will be queried again after the
+	// object has moved, give the farthest it may move before the set is rebuilt.
+	void Add(Body &body, double margin = 0.);
 	// Finish adding objects (and organize them into the final lookup table).
 	void Finish();
 
+	// All of the queries below only read from the collision set, so once it is
+	// finished they may be made from several threads at once. The exception is
+	// the versions of Circle() and Ring() that return a reference to a shared
+	// result vector, which is overwritten by the next call to either.
+
 	// Get the first object that collides with the given projectile. If a
 	// "closest hit" value is given, update that value.
 	Body *Line(const Projectile &projectile, double *closestHit = nullptr) const;
@@ -52,36 +64,70 @@ public:
 
 	// Get all objects within the given range of the given point.
 	const std::vector<Body *> &Circle(const Point &center, double radius) const;
+	void Circle(const Point &center, double radius, std::vector<Body *> &result) const;
 	// Get all objects touching a ring with a given inner and outer range
 	// centered at the given point.
 	const std::vector<Body *> &Ring(const Point &center, double inner, double outer) const;
+	void Ring(const Point &center, double inner, double outer, std::vector<Body *> &result) const;
 
 	// Get all objects within this collision set.
 	const std::vector<Body *> &All() const;
 
 
 private:
+	class Closest;
+
 	class Entry {
 	public:
 		Entry() = default;
-		Entry(Body *body, unsigned seenIndex, int x, int y) : body(body), seenIndex(seenIndex), x(x), y(y) {}
+		Entry(Body *body, const Mask *mask, unsigned level, int x, int y, int minX, int minY, int maxX, int maxY)
+			: body(body), mask(mask), level(level), x(x), y(y), minX(minX), minY(minY), maxX(maxX), maxY(maxY) {}
+
+		// Get the body's mask, which was looked up when it was added unless the
+		// set has no step.
+		const Mask &GetMask(int step) const;
 
 		Body *body;
-		unsigned seenIndex;
+		const Mask *mask;
+		// The level of the grid, and the cell within that level, that this
+		// entry is for.
+		unsigned level;
 		int x;
 		int y;
+		// The range of grid cells the body covers. A query that covers more
+		// than one of them uses this to only consider the body once.
+		int minX;
+		int minY;
+		int maxX;
+		int maxY;
 	};
 
 
 private:
-	// The size of individual cells of the grid.
-	unsigned CELL_SIZE;
+	// Check for collisions with a line in one level of the grid.
+	void Line(unsigned level, const Point &from, const Point &to, const Government *pGov, const Body *target,
+		Closest &closest) const;
+	// Choose the size of the grid's cells for the next step.
+	void Resize();
+
+
+private:
+	// The cell size and count that this set was created with.
+	unsigned BASE_SHIFT;
+	unsigned BASE_CELLS;
+	bool adaptive;
+
+	// The size of individual cells of the finest level of the grid. Each level
+	// above it has cells that are larger by a constant factor.
 	unsigned SHIFT;
-	unsigned CELL_MASK;
 
-	// The number of grid cells.
+	// The number of grid cells along each axis, in each level.
 	unsigned CELLS;
 	unsigned WRAP_MASK;
+	// Which levels of the grid hold any objects.
+	unsigned usedLevels;
+	// The cell size to use the next time the set is cleared.
+	unsigned nextShift;
 
 	// The current game engine step.
 	int step;
@@ -95,10 +141,8 @@ private:
 
 	// Vector for returning the result of a circle query.
 	mutable std::vector<Body *> result;
-
-	// Keep track of which objects we've already considered
-	mutable std::vector<unsigned> seen;
-	mutable unsigned seenEpoch = 0;
+	// Scratch space for choosing the cell size.
+	std::vector<double> radii;
 };
 
 
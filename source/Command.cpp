@@ -363,6 +363,24 @@ double Command::Turn() const
 
 
 
+// Get or restore the exact state of this command, including the turn
+// amount, e.g. to record the player's input and play it back later.
+uint64_t Command::State() const
+{
+	return state;
+}
+
+
+
+Command Command::FromState(uint64_t state, double turn)
+{
+	Command command(state);
+	command.turn = turn;
+	return command;
+}
+
+
+
 // Check if any bits are set in this command (including a nonzero turn).
 Command::operator bool() const
 {
@@ -126,6 +126,11 @@ public:
 	void SetTurn(double amount);
 	double Turn() const;
 
+	// Get or restore the exact state of this command, including the turn
+	// amount, e.g. to record the player's input and play it back later.
+	uint64_t State() const;
+	static Command FromState(uint64_t state, double turn);
+
 	// Check if any bits are set in this command (including a nonzero turn).
 	explicit operator bool() const;
 	bool operator!() const;
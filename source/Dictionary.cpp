@@ -16,8 +16,8 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "Dictionary.h"
 
 #include <cstring>
+#include <map>
 #include <mutex>
-#include <set>
 #include <string>
 
 using namespace std;
@@ -47,17 +47,73 @@ namespace {
 		return make_pair(low, false);
 	}
 
-	// String interning: return a pointer to a character string that matches the
-	// given string but has static storage duration.
-	const char *Intern(const char *key)
+	// The index of an interned string that no Key has been created for.
+	const size_t NO_KEY = static_cast<size_t>(-1);
+
+	// Keys may be created, and dictionaries modified, from multiple threads.
+	mutex &InternMutex()
 	{
-		static set<string> interned;
 		static mutex m;
+		return m;
+	}
+
+	// Every interned string, along with its Key index (if it has one).
+	map<string, size_t> &Interned()
+	{
+		static map<string, size_t> interned;
+		return interned;
+	}
+
+	// The interned string that each Key index refers to.
+	vector<const char *> &KeyNames()
+	{
+		static vector<const char *> names;
+		return names;
+	}
+
+	// String interning: return a pointer to a character string that matches the
+	// given string but has static storage duration. Also get its Key index.
+	const char *Intern(const char *key, size_t &index)
+	{
+		lock_guard<mutex> lock(InternMutex());
+		auto it = Interned().emplace(key, NO_KEY).first;
+		index = it->second;
+		return it->first.c_str();
+	}
+
+	// Get the names of the Keys that have been created, starting from the given
+	// index. The names have static storage duration, so they can be used after
+	// the lock is released.
+	vector<const char *> KeyNamesFrom(size_t first)
+	{
+		lock_guard<mutex> lock(InternMutex());
+		const vector<const char *> &names = KeyNames();
+		if(first >= names.size())
+			return vector<const char *>();
+		return vector<const char *>(names.begin() + first, names.end());
+	}
+}
+
 
-		// Just in case this function is accessed from multiple threads:
-		lock_guard<mutex> lock(m);
-		return interned.insert(key).first->c_str();
+
+Dictionary::Key::Key(const char *name)
+{
+	lock_guard<mutex> lock(InternMutex());
+	auto it = Interned().emplace(name, NO_KEY).first;
+	if(it->second == NO_KEY)
+	{
+		it->second = KeyNames().size();
+		KeyNames().push_back(it->first.c_str());
 	}
+	this->name = it->first.c_str();
+	index = it->second;
+}
+
+
+
+const char *Dictionary::Key::Name() const
+{
+	return name;
 }
 
 
@@ -68,7 +124,11 @@ double &Dictionary::operator[](const char *key)
 	if(pos.second)
 		return data()[pos.first].second;
 
-	return insert(begin() + pos.first, make_pair(Intern(key), 0.))->second;
+	size_t index;
+	const char *name = Intern(key, index);
+	insert(begin() + pos.first, make_pair(name, 0.));
+	UpdateKeys(pos.first, index);
+	return data()[pos.first].second;
 }
 
 
@@ -92,3 +152,36 @@ double Dictionary::Get(const string &key) const
 {
 	return Get(key.c_str());
 }
+
+
+
+double Dictionary::Get(const Key &key) const
+{
+	if(key.index < keyPositions.size())
+	{
+		unsigned position = keyPositions[key.index];
+		return (position ? data()[position - 1].second : 0.);
+	}
+	return Get(key.name);
+}
+
+
+
+// Update the positions of the keys after a new entry has been inserted.
+void Dictionary::UpdateKeys(size_t position, size_t index)
+{
+	// Every entry from the insertion point onward has moved over by one.
+	for(unsigned &it : keyPositions)
+		if(it > position)
+			++it;
+	if(index < keyPositions.size())
+		keyPositions[index] = position + 1;
+
+	// If any keys have been created since this dictionary was last modified,
+	// look up where they are now.
+	for(const char *name : KeyNamesFrom(keyPositions.size()))
+	{
+		pair<size_t, bool> pos = Search(name, *this);
+		keyPositions.push_back(pos.second ? pos.first + 1 : 0);
+	}
+}
@@ -16,6 +16,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #ifndef DICTIONARY_H_
 #define DICTIONARY_H_
 
+#include <cstddef>
 #include <string>
 #include <utility>
 #include <vector>
@@ -27,6 +28,25 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 // compared to an STL map. That makes it suitable for ship attributes, which are
 // changed much less frequently than they are queried.
 class Dictionary : private std::vector<std::pair<const char *, double>> {
+public:
+	// A key that is resolved once, ahead of time, so that looking it up in any
+	// dictionary does not require any string comparisons. Keys are meant to be
+	// created for the attributes that are looked up most often, preferably as
+	// static constants so that they exist before any dictionary is filled in.
+	class Key {
+	public:
+		explicit Key(const char *name);
+
+		const char *Name() const;
+
+	private:
+		const char *name;
+		size_t index;
+
+		friend class Dictionary;
+	};
+
+
 public:
 	// Access a key for modifying it:
 	double &operator[](const char *key);
@@ -34,11 +54,24 @@ public:
 	// Get the value of a key, or 0 if it does not exist:
 	double Get(const char *key) const;
 	double Get(const std::string &key) const;
+	double Get(const Key &key) const;
 
 	// Expose certain functions from the underlying vector:
 	using std::vector<std::pair<const char *, double>>::empty;
 	using std::vector<std::pair<const char *, double>>::begin;
 	using std::vector<std::pair<const char *, double>>::end;
+
+
+private:
+	// Update the positions of the keys after a new entry has been inserted.
+	void UpdateKeys(size_t position, size_t index);
+
+
+private:
+	// For each Key index, one more than the position of that key in this
+	// dictionary, or 0 if it is not in this dictionary. Keys that were created
+	// after the last time an entry was inserted may be missing from this list.
+	std::vector<unsigned> keyPositions;
 };
 
 
@@ -16,13 +16,16 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "Engine.h"
 
 #include "AlertLabel.h"
+#include "AttributeKeys.h"
 #include "Audio.h"
 #include "CategoryList.h"
 #include "CategoryTypes.h"
 #include "CoreStartData.h"
 #include "DamageDealt.h"
 #include "DamageProfile.h"
+#include "Dictionary.h"
 #include "Effect.h"
+#include "Files.h"
 #include "FillShader.h"
 #include "Fleet.h"
 #include "Flotsam.h"
@@ -53,6 +56,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "Preferences.h"
 #include "Projectile.h"
 #include "Random.h"
+#include "Replay.h"
 #include "RingShader.h"
 #include "Screen.h"
 #include "Ship.h"
@@ -63,6 +67,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "SpriteShader.h"
 #include "StarField.h"
 #include "StellarObject.h"
+#include "StepTimings.h"
 #include "System.h"
 #include "SystemEntry.h"
 #include "Test.h"
@@ -74,8 +79,10 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <string>
 
+using namespace AttributeKeys;
 using namespace std;
 
 namespace {
@@ -235,15 +242,58 @@ namespace {
 		return *GameData::Colors().Get("minable target pointer unselected");
 	}
 
+	// "Phasing" projectiles that have a target will only ever hit that target.
+	bool IsPhasingAtTarget(const Projectile &projectile)
+	{
+		return projectile.GetGovernment() && projectile.GetWeapon().IsPhasing() && projectile.Target();
+	}
+
 	const double RADAR_SCALE = .025;
 	const double MAX_FUEL_DISPLAY = 5000.;
+
+	// The phases of each step that are timed in debug mode.
+	enum StepPhase : size_t {
+		PHASE_AI,
+		PHASE_SHIPS,
+		PHASE_ASTEROIDS,
+		PHASE_FLOTSAM,
+		PHASE_PROJECTILES,
+		PHASE_WEATHER,
+		PHASE_COLLISION_SETS,
+		PHASE_COLLISIONS,
+		PHASE_SCANNING,
+		PHASE_RADAR,
+		PHASE_DRAW_LISTS
+	};
+	const vector<string> PHASE_NAMES = {
+		"AI", "ships", "asteroids", "flotsam", "projectiles", "weather",
+		"collision sets", "collisions", "scanning", "radar", "draw lists"
+	};
+	// How often the timings shown on screen are updated.
+	const int TIMING_DISPLAY_INTERVAL = 30;
+
+	// Mix the bits of the given value into a 64-bit FNV-1a hash.
+	void HashValue(uint64_t &hash, double value)
+	{
+		unsigned char bytes[sizeof(value)];
+		memcpy(bytes, &value, sizeof(value));
+		for(unsigned char byte : bytes)
+			hash = (hash ^ byte) * 1099511628211ull;
+	}
+
+	void HashPoint(uint64_t &hash, const Point &point)
+	{
+		HashValue(hash, point.X());
+		HashValue(hash, point.Y());
+	}
 }
 
 
 
 Engine::Engine(PlayerInfo &player)
-	: player(player), ai(ships, asteroids.Minables(), flotsam),
-	ammoDisplay(player), shipCollisions(256u, 32u)
+	: player(player), ai(ships, asteroids.Minables(), flotsam, workers, frameArena),
+	ammoDisplay(player), shipCollisions(256u, 32u, true), antiMissileCollisions(512u, 32u),
+	stepTimings(PHASE_NAMES)
 {
 	zoom = Preferences::ViewZoom();
 
@@ -300,6 +350,9 @@ Engine::~Engine()
 	}
 	condition.notify_all();
 	calcThread.join();
+
+	if(recording)
+		FinishRecording();
 }
 
 
@@ -490,6 +543,32 @@ void Engine::Step(bool isActive)
 	eventQueue.clear();
 
 	// The calculation thread was paused by MainPanel before calling this function, so it is safe to access things.
+	UpdateStepTimings();
+
+	// A recording ends as soon as the engine stops being active, e.g. because
+	// the player landed or a dialog was shown.
+	if(recording && !isActive)
+		FinishRecording();
+	else if(recording)
+	{
+		recording->Steps().emplace_back();
+		recording->Steps().back().checksum = StateHash();
+	}
+	else if(playback && isActive)
+	{
+		// Once a recording has been played back, go back to the regular input.
+		if(playbackStep < playback->Steps().size())
+			++playbackStep;
+		else
+			playback = nullptr;
+	}
+	// Both threads draw random numbers that change the course of the flight,
+	// so they are reseeded in every step.
+	if(recording)
+		SeedRandom(recording->Seed());
+	else if(playback)
+		SeedRandom(playback->Seed());
+
 	const shared_ptr<Ship> flagship = player.FlagshipPtr();
 	const StellarObject *object = player.GetStellarObject();
 	if(object)
@@ -524,7 +603,9 @@ void Engine::Step(bool isActive)
 	ai.UpdateEvents(events);
 	if(isActive)
 	{
-		HandleKeyboardInputs();
+		// When playing back a recording, the keyboard is ignored.
+		if(!playback)
+			HandleKeyboardInputs();
 		// Ignore any inputs given when first becoming active, since those inputs
 		// were issued when some other panel (e.g. planet, hail) was displayed.
 		if(!wasActive)
@@ -536,10 +617,16 @@ void Engine::Step(bool isActive)
 			// engine to handle the testing.
 			if(testContext)
 			{
+				// Let timing steps know how long the step that just finished took.
+				testContext->SetStepTime(1000. * stepTime);
 				const Test *runningTest = testContext->CurrentTest();
 				if(runningTest)
 					runningTest->Step(*testContext, player, activeCommands);
 			}
+			if(playback)
+				activeCommands = playback->Steps()[playbackStep - 1].commands;
+			else if(recording)
+				recording->Steps().back().commands = activeCommands;
 			ai.UpdateKeys(player, activeCommands);
 		}
 	}
@@ -689,7 +776,7 @@ void Engine::Step(bool isActive)
 		// Have an alarm label flash up when enemy ships are in the system
 		if(alarmTime && step / 20 % 2 && Preferences::DisplayVisualAlert())
 			info.SetCondition("red alert");
-		double fuelCap = flagship->Attributes().Get("fuel capacity");
+		double fuelCap = flagship->Attributes().Get(FUEL_CAPACITY);
 		// If the flagship has a large amount of fuel, display a solid bar.
 		// Otherwise, display a segment for every 100 units of fuel.
 		if(fuelCap <= MAX_FUEL_DISPLAY)
@@ -770,7 +857,7 @@ void Engine::Step(bool isActive)
 
 		targetVector = targetAsteroid->Position() - center;
 
-		if(flagship->Attributes().Get("tactical scan power"))
+		if(flagship->Attributes().Get(TACTICAL_SCAN_POWER))
 		{
 			info.SetCondition("range display");
 			info.SetBar("target hull", targetAsteroid->Hull(), 20.);
@@ -813,7 +900,7 @@ void Engine::Step(bool isActive)
 			targetVector = target->Position() - center;
 
 			// Check if the target is close enough to show tactical information.
-			double tacticalRange = 100. * sqrt(flagship->Attributes().Get("tactical scan power"));
+			double tacticalRange = 100. * sqrt(flagship->Attributes().Get(TACTICAL_SCAN_POWER));
 			double targetRange = target->Position().Distance(flagship->Position());
 			if(tacticalRange)
 			{
@@ -822,14 +909,14 @@ void Engine::Step(bool isActive)
 			}
 			// Actual tactical information requires a scrutable
 			// target that is within the tactical scanner range.
-			if((targetRange <= tacticalRange && !target->Attributes().Get("inscrutable"))
+			if((targetRange <= tacticalRange && !target->Attributes().Get(INSCRUTABLE))
 					|| (tacticalRange && target->IsYours()))
 			{
 				info.SetCondition("tactical display");
 				info.SetString("target crew", to_string(target->Crew()));
-				int fuel = round(target->Fuel() * target->Attributes().Get("fuel capacity"));
+				int fuel = round(target->Fuel() * target->Attributes().Get(FUEL_CAPACITY));
 				info.SetString("target fuel", to_string(fuel));
-				int energy = round(target->Energy() * target->Attributes().Get("energy capacity"));
+				int energy = round(target->Energy() * target->Attributes().Get(ENERGY_CAPACITY));
 				info.SetString("target energy", to_string(energy));
 				int heat = round(100. * target->Heat());
 				info.SetString("target heat", to_string(heat) + "%");
@@ -845,6 +932,8 @@ void Engine::Step(bool isActive)
 			0., 10. + max(20., width * .5), 4, Angle(pos).Degrees() + 180.);
 	}
 	// Handle any events that change the selected ships.
+	if(isActive)
+		RecordOrReplayClicks();
 	if(groupSelect >= 0)
 	{
 		// This has to be done in Step() to avoid race conditions.
@@ -905,7 +994,7 @@ void Engine::Step(bool isActive)
 	bool shouldCatalogAsteroids = (!isAsteroidCatalogComplete && !Random::Int(20));
 	if(shouldShowAsteroidOverlay || shouldCatalogAsteroids)
 	{
-		double scanRangeMetric = flagship ? 10000. * flagship->Attributes().Get("asteroid scan power") : 0.;
+		double scanRangeMetric = flagship ? 10000. * flagship->Attributes().Get(ASTEROID_SCAN_POWER) : 0.;
 		if(flagship && scanRangeMetric && !flagship->IsHyperspacing())
 		{
 			bool scanComplete = true;
@@ -958,6 +1047,9 @@ void Engine::Step(bool isActive)
 // Begin the next step of calculations.
 void Engine::Go()
 {
+	// The calculation thread is paused, so this is the time to catch up with
+	// any changes in which governments are enemies.
+	GameData::GetPolitics().UpdateHostility();
 	{
 		unique_lock<mutex> lock(swapMutex);
 		++step;
@@ -971,7 +1063,7 @@ void Engine::Go()
 
 // Pass the list of game events to MainPanel for handling by the player, and any
 // UI element generation.
-list<ShipEvent> &Engine::Events()
+vector<ShipEvent> &Engine::Events()
 {
 	return events;
 }
@@ -1131,12 +1223,27 @@ void Engine::Draw() const
 	// filling the entire backlog of sprites before landing on a planet.
 	GameData::ProcessSprites();
 
+	// The debug lines are stacked below each other at the top of the screen.
+	Point point(-10., Screen::Height() * -.5 + 5.);
 	if(Preferences::Has("Show CPU / GPU load"))
 	{
 		string loadString = to_string(lround(load * 100.)) + "% CPU";
 		Color color = *colors.Get("medium");
-		font.Draw(loadString,
-			Point(-10 - font.Width(loadString), Screen::Height() * -.5 + 5.), color);
+		font.Draw(loadString, point - Point(font.Width(loadString), 0.), color);
+		point.Y() += 20.;
+		string allocString = to_string(frameAllocations) + " arena allocations / "
+			+ to_string(frameHeapAllocations) + " new arena blocks";
+		font.Draw(allocString, point - Point(font.Width(allocString), 0.), color);
+		point.Y() += 20.;
+	}
+	if(StepTimings::IsEnabled())
+	{
+		Color color = *colors.Get("medium");
+		for(const string &line : timingLines)
+		{
+			font.Draw(line, point - Point(font.Width(line), 0.), color);
+			point.Y() += 20.;
+		}
 	}
 }
 
@@ -1150,6 +1257,31 @@ void Engine::SetTestContext(TestContext &newTestContext)
 
 
 
+// Record the player's input from now until the engine is no longer active,
+// starting from the given saved game. This must be called before Place().
+void Engine::StartRecording(const string &savePath)
+{
+	// Each recording gets a new seed, so that recorded flights still differ.
+	uint64_t seed = (static_cast<uint64_t>(Random::Int()) << 32) | Random::Int();
+	recording.reset(new Replay);
+	recording->Begin(savePath, seed, step);
+	SeedRandom(seed);
+}
+
+
+
+// Take the player's input from the given recording instead of from the
+// keyboard and mouse. This must be called before Place().
+void Engine::Play(const Replay &replay)
+{
+	playback = &replay;
+	playbackStep = 0;
+	step = replay.FirstStep();
+	SeedRandom(replay.Seed());
+}
+
+
+
 // Select the object the player clicked on.
 void Engine::Click(const Point &from, const Point &to, bool hasShift, bool hasControl)
 {
@@ -1225,6 +1357,38 @@ void Engine::BreakTargeting(const Government *gov)
 
 
 
+uint64_t Engine::StateHash() const
+{
+	uint64_t hash = 14695981039346656037ull;
+	for(const shared_ptr<Ship> &ship : ships)
+	{
+		HashPoint(hash, ship->Position());
+		HashPoint(hash, ship->Velocity());
+		HashValue(hash, ship->Facing().Degrees());
+		HashValue(hash, ship->Shields());
+		HashValue(hash, ship->Hull());
+		HashValue(hash, ship->Energy());
+		HashValue(hash, ship->Fuel());
+	}
+	for(const Projectile &projectile : projectiles)
+	{
+		HashPoint(hash, projectile.Position());
+		HashPoint(hash, projectile.Velocity());
+	}
+	for(const shared_ptr<Flotsam> &it : flotsam)
+		HashPoint(hash, it->Position());
+	return hash;
+}
+
+
+
+const StepTimings &Engine::Timings() const
+{
+	return stepTimings;
+}
+
+
+
 void Engine::EnterSystem()
 {
 	ai.Clean();
@@ -1366,6 +1530,7 @@ void Engine::EnterSystem()
 // Thread entry point.
 void Engine::ThreadEntryPoint()
 {
+	Random::ThreadGuard randomGuard;
 	while(true)
 	{
 		{
@@ -1393,6 +1558,19 @@ void Engine::CalculateStep()
 {
 	FrameTimer loadTimer;
 
+	// The random numbers of this thread must match those of the recording.
+	if(shouldSeedCalculation)
+	{
+		Random::Seed(calculationSeed);
+		shouldSeedCalculation = false;
+	}
+
+	// Nothing that was allocated from the frame arena during the last step is
+	// still in use.
+	frameAllocations = frameArena.Allocations();
+	frameHeapAllocations = frameArena.HeapAllocations();
+	frameArena.Reset();
+
 	// If there is a pending zoom update then use it
 	// because the zoom will get updated in the main thread
 	// as soon as the calculation thread is finished.
@@ -1406,10 +1584,15 @@ void Engine::CalculateStep()
 	if(!player.GetSystem())
 		return;
 
+	// In debug mode, time each phase of the step to find out what is slow.
+	StepTimings::Timer timer(stepTimings);
+
 	// Handle the mouse input of the mouse navigation
 	HandleMouseInput(activeCommands);
 	// Now, all the ships must decide what they are doing next.
+	timer.Start(PHASE_AI);
 	ai.Step(player, activeCommands);
+	timer.Stop();
 
 	// Clear the active players commands, they are all processed at this point.
 	activeCommands.Clear();
@@ -1428,8 +1611,10 @@ void Engine::CalculateStep()
 	const Ship *flagship = player.Flagship();
 	bool wasHyperspacing = (flagship && flagship->IsEnteringHyperspace());
 	// Move all the ships.
+	timer.Start(PHASE_SHIPS);
 	for(const shared_ptr<Ship> &it : ships)
 		MoveShip(it);
+	timer.Stop();
 	// If the flagship just began jumping, play the appropriate sound.
 	if(!wasHyperspacing && flagship && flagship->IsEnteringHyperspace())
 	{
@@ -1468,28 +1653,42 @@ void Engine::CalculateStep()
 
 	// Move the asteroids. This must be done before collision detection. Minables
 	// may create visuals or flotsam.
+	timer.Start(PHASE_ASTEROIDS);
 	asteroids.Step(newVisuals, newFlotsam, step);
 
 	// Move the flotsam. This must happen after the ships move, because flotsam
 	// checks if any ship has picked it up.
+	timer.Start(PHASE_FLOTSAM);
 	for(const shared_ptr<Flotsam> &it : flotsam)
 		it->Move(newVisuals);
 	Prune(flotsam);
 
 	// Move the projectiles.
+	timer.Start(PHASE_PROJECTILES);
 	for(Projectile &projectile : projectiles)
 		projectile.Move(newVisuals, newProjectiles);
 	Prune(projectiles);
 
 	// Step the weather.
+	timer.Start(PHASE_WEATHER);
 	for(Weather &weather : activeWeather)
 		weather.Step(newVisuals, flagship ? flagship->Position() : center);
 	Prune(activeWeather);
+	timer.Stop();
 
-	// Move the visuals.
+	// Move the visuals, removing any that have expired in the same pass.
+	auto out = visuals.begin();
 	for(Visual &visual : visuals)
+	{
 		visual.Move();
-	Prune(visuals);
+		if(!visual.ShouldBeRemoved())
+		{
+			if(&*out != &visual)
+				*out = std::move(visual);
+			++out;
+		}
+	}
+	visuals.erase(out, visuals.end());
 
 	// Perform various minor actions.
 	SpawnFleets();
@@ -1513,26 +1712,31 @@ void Engine::CalculateStep()
 		--grudgeTime;
 
 	// Populate the collision detection lookup sets.
+	timer.Start(PHASE_COLLISION_SETS);
 	FillCollisionSets();
 
 	// Perform collision detection.
-	for(Projectile &projectile : projectiles)
-		DoCollisions(projectile);
+	timer.Start(PHASE_COLLISIONS);
+	DoCollisions();
 	// Now that collision detection is done, clear the cache of ships with anti-
 	// missile systems ready to fire.
 	hasAntiMissile.clear();
 
 	// Damage ships from any active weather events.
+	timer.Start(PHASE_WEATHER);
 	for(Weather &weather : activeWeather)
 		DoWeather(weather);
 
 	// Check for flotsam collection (collisions with ships).
+	timer.Start(PHASE_FLOTSAM);
 	for(const shared_ptr<Flotsam> &it : flotsam)
 		DoCollection(*it);
 
 	// Check for ship scanning.
+	timer.Start(PHASE_SCANNING);
 	for(const shared_ptr<Ship> &it : ships)
 		DoScanning(it);
+	timer.Stop();
 
 	// Draw the objects. Start by figuring out where the view should be centered:
 	Point newCenter = center;
@@ -1547,9 +1751,11 @@ void Engine::CalculateStep()
 	radar[calcTickTock].SetCenter(newCenter);
 
 	// Populate the radar.
+	timer.Start(PHASE_RADAR);
 	FillRadar();
 
 	// Draw the planets.
+	timer.Start(PHASE_DRAW_LISTS);
 	for(const StellarObject &object : playerSystem->Objects())
 		if(object.HasSprite())
 		{
@@ -1617,9 +1823,12 @@ void Engine::CalculateStep()
 	// Draw the visuals.
 	for(const Visual &visual : visuals)
 		batchDraw[calcTickTock].AddVisual(visual);
+	timer.Stop();
+	stepTimings.EndStep();
 
 	// Keep track of how much of the CPU time we are using.
-	loadSum += loadTimer.Time();
+	stepTime = loadTimer.Time();
+	loadSum += stepTime;
 	if(++loadCount == 60)
 	{
 		load = loadSum;
@@ -1630,6 +1839,37 @@ void Engine::CalculateStep()
 
 
 
+// Refresh the step timings shown in debug mode, and write them to a file if
+// that was requested. This must only be called while the calculation thread
+// is paused.
+void Engine::UpdateStepTimings()
+{
+	if(!StepTimings::IsEnabled())
+		return;
+
+	if(StepTimings::TakeDumpRequest())
+	{
+		string path = Files::Config() + "step timings.csv";
+		stepTimings.WriteCSV(path);
+		Messages::Add("Wrote the timings of the last steps to \"" + path + "\".", Messages::Importance::High);
+	}
+
+	if(++timingDisplayCount < TIMING_DISPLAY_INTERVAL)
+		return;
+	timingDisplayCount = 0;
+
+	timingLines.clear();
+	timingLines.emplace_back("step phase: min / avg / p99 ms");
+	for(size_t phase = 0; phase < stepTimings.PhaseCount(); ++phase)
+	{
+		StepTimings::Stats stats = stepTimings.GetStats(phase);
+		timingLines.emplace_back(stepTimings.PhaseName(phase) + ": " + Format::Decimal(stats.min, 2)
+			+ " / " + Format::Decimal(stats.average, 2) + " / " + Format::Decimal(stats.p99, 2));
+	}
+}
+
+
+
 // Move a ship. Also determine if the ship should generate hyperspace sounds or
 // boarding events, fire weapons, and launch fighters.
 void Engine::MoveShip(const shared_ptr<Ship> &ship)
@@ -2034,10 +2274,10 @@ void Engine::HandleMouseClicks()
 			}
 		}
 	}
-	else if(flagship->Attributes().Get("asteroid scan power"))
+	else if(flagship->Attributes().Get(ASTEROID_SCAN_POWER))
 	{
 		// If the click was not on any ship, check if it was on a minable.
-		double scanRange = 100. * sqrt(flagship->Attributes().Get("asteroid scan power"));
+		double scanRange = 100. * sqrt(flagship->Attributes().Get(ASTEROID_SCAN_POWER));
 		for(const shared_ptr<Minable> &minable : asteroids.Minables())
 		{
 			Point position = minable->Position() - flagship->Position();
@@ -2075,41 +2315,180 @@ void Engine::HandleMouseInput(Command &activeCommands)
 	// will temporarily turn ON mouse control. If mouse toggle is ON, then mouse
 	// hold will temporarily turn OFF mouse control.
 	isMouseTurningEnabled = (isMouseHoldEnabled ^ isMouseToggleEnabled);
+	bool rightMouseButtonHeld = false;
+	Point mousePosition;
+	if(playback)
+	{
+		// Take the mouse input from the recording instead.
+		const Replay::Step *played = playbackStep ? &playback->Steps()[playbackStep - 1] : nullptr;
+		isMouseTurningEnabled = played && played->isMouseTurning;
+		if(isMouseTurningEnabled)
+		{
+			rightMouseButtonHeld = played->isMouseFiring;
+			mousePosition = played->mousePosition;
+		}
+	}
+	else if(isMouseTurningEnabled)
+	{
+		int mousePosX;
+		int mousePosY;
+		if((SDL_GetMouseState(&mousePosX, &mousePosY) & SDL_BUTTON_RMASK) != 0)
+			rightMouseButtonHeld = true;
+		double relX = mousePosX - Screen::RawWidth() / 2;
+		double relY = mousePosY - Screen::RawHeight() / 2;
+		mousePosition = Point(relX, relY);
+	}
+	if(recording)
+	{
+		// The step right after taking off happens before any input has been
+		// recorded, so the mouse is ignored in it.
+		if(recording->Steps().empty())
+			isMouseTurningEnabled = false;
+		else
+		{
+			Replay::Step &recorded = recording->Steps().back();
+			recorded.isMouseTurning = isMouseTurningEnabled;
+			recorded.isMouseFiring = isMouseTurningEnabled && rightMouseButtonHeld;
+			recorded.mousePosition = mousePosition;
+		}
+	}
 	if(!isMouseTurningEnabled)
 		return;
 	activeCommands.Set(Command::MOUSE_TURNING_HOLD);
-	bool rightMouseButtonHeld = false;
-	int mousePosX;
-	int mousePosY;
-	if((SDL_GetMouseState(&mousePosX, &mousePosY) & SDL_BUTTON_RMASK) != 0)
-		rightMouseButtonHeld = true;
-	double relX = mousePosX - Screen::RawWidth() / 2;
-	double relY = mousePosY - Screen::RawHeight() / 2;
-	ai.SetMousePosition(Point(relX, relY));
+	ai.SetMousePosition(mousePosition);
 
 	// Activate firing command.
-	if(isMouseTurningEnabled && rightMouseButtonHeld)
+	if(rightMouseButtonHeld)
 		activeCommands.Set(Command::PRIMARY);
 }
 
 
 
-// Perform collision detection. Note that unlike the preceding functions, this
-// one adds any visuals that are created directly to the main visuals list. If
-// this is multi-threaded in the future, that will need to change.
-void Engine::DoCollisions(Projectile &projectile)
+// Record the clicks and group selections that are about to be handled in this
+// step, or take them from the recording that is being played back.
+void Engine::RecordOrReplayClicks()
+{
+	if(playback)
+	{
+		const Replay::Step &played = playback->Steps()[playbackStep - 1];
+		doClickNextStep = played.hasClick;
+		if(played.hasClick)
+		{
+			isRightClick = played.isRightClick;
+			isRadarClick = played.isRadarClick;
+			clickPoint = played.clickPoint;
+			clickBox = played.clickBox;
+			uiClickBox = played.uiClickBox;
+		}
+		groupSelect = played.group;
+		hasShift = played.hasShift;
+		hasControl = played.hasControl;
+	}
+	else if(recording)
+	{
+		Replay::Step &recorded = recording->Steps().back();
+		recorded.hasClick = doClickNextStep;
+		if(doClickNextStep)
+		{
+			recorded.isRightClick = isRightClick;
+			recorded.isRadarClick = isRadarClick;
+			recorded.clickPoint = clickPoint;
+			recorded.clickBox = clickBox;
+			recorded.uiClickBox = uiClickBox;
+		}
+		recorded.group = groupSelect;
+		if(doClickNextStep || groupSelect >= 0)
+		{
+			recorded.hasShift = hasShift;
+			recorded.hasControl = hasControl;
+		}
+	}
+}
+
+
+
+void Engine::FinishRecording()
+{
+	const string &path = Replay::RecordPath();
+	recording->Save(path);
+	Messages::Add("Saved a recording of the last " + to_string(recording->Steps().size())
+		+ " steps to \"" + path + "\".", Messages::Importance::High);
+	recording.reset();
+}
+
+
+
+// Seed the random numbers of the current step from the given seed. Each step
+// gets its own numbers, so that what this thread draws in between steps (e.g.
+// for sounds) makes no difference. This must only be called while the
+// calculation thread is paused.
+void Engine::SeedRandom(uint64_t seed)
+{
+	uint64_t stepSeed = seed ^ (static_cast<uint64_t>(step) * 0x9E3779B97F4A7C15ull);
+	Random::Seed(stepSeed);
+	// The calculation thread draws different numbers from this thread's.
+	shouldSeedCalculation = true;
+	calculationSeed = ~stepSeed;
+}
+
+
+
+// Perform collision detection. Finding out what each projectile hits does not
+// change anything, so that is split up among the worker threads. The effects of
+// the hits are then applied in the same order as the projectiles.
+void Engine::DoCollisions()
+{
+	if(collisions.size() < projectiles.size())
+		collisions.resize(projectiles.size());
+
+	// The target of a phasing projectile may not be in the collision set, in
+	// which case its mask has not been looked up for this step yet. Leave those
+	// projectiles for the serial pass.
+	auto findCollisions = [this](size_t index) -> void
+	{
+		if(!IsPhasingAtTarget(projectiles[index]))
+			FindCollisions(projectiles[index], collisions[index]);
+	};
+	workers.Run(projectiles.size(), findCollisions);
+
+	antiMissileCollisions.Clear(-1);
+	antiMissileOrder.clear();
+	maxAntiMissileRange = 0.;
+	for(size_t i = 0; i < hasAntiMissile.size(); ++i)
+	{
+		antiMissileCollisions.Add(*hasAntiMissile[i]);
+		antiMissileOrder.emplace_back(hasAntiMissile[i], i);
+		maxAntiMissileRange = max(maxAntiMissileRange, hasAntiMissile[i]->AntiMissileRange());
+	}
+	antiMissileCollisions.Finish();
+	sort(antiMissileOrder.begin(), antiMissileOrder.end());
+
+	for(size_t i = 0; i < projectiles.size(); ++i)
+	{
+		if(IsPhasingAtTarget(projectiles[i]))
+			FindCollisions(projectiles[i], collisions[i]);
+		DoCollisions(projectiles[i], collisions[i]);
+	}
+}
+
+
+
+// Find out what the given projectile hits in this step, without changing any
+// of the objects involved.
+void Engine::FindCollisions(const Projectile &projectile, Collision &collision) const
 {
 	// The asteroids can collide with projectiles, the same as any other
 	// object. If the asteroid turns out to be closer than the ship, it
 	// shields the ship (unless the projectile has a blast radius).
-	Point hitVelocity;
-	double closestHit = 1.;
-	shared_ptr<Ship> hit;
+	collision.closestHit = 1.;
+	collision.hitVelocity = Point();
+	collision.ship = nullptr;
+	collision.minable = nullptr;
 	const Government *gov = projectile.GetGovernment();
 
 	// If this "projectile" is a ship explosion, it always explodes.
 	if(!gov)
-		closestHit = 0.;
+		collision.closestHit = 0.;
 	else if(projectile.GetWeapon().IsPhasing() && projectile.Target())
 	{
 		// "Phasing" projectiles that have a target will never hit any other ship.
@@ -2120,8 +2499,8 @@ void Engine::DoCollisions(Projectile &projectile)
 			double range = target->GetMask(step).Collide(offset, projectile.Velocity(), target->Facing());
 			if(range < 1.)
 			{
-				closestHit = range;
-				hit = target;
+				collision.closestHit = range;
+				collision.ship = target.get();
 			}
 		}
 	}
@@ -2130,22 +2509,25 @@ void Engine::DoCollisions(Projectile &projectile)
 		// For weapons with a trigger radius, check if any detectable object will set it off.
 		double triggerRadius = projectile.GetWeapon().TriggerRadius();
 		if(triggerRadius)
-			for(const Body *body : shipCollisions.Circle(projectile.Position(), triggerRadius))
+		{
+			shipCollisions.Circle(projectile.Position(), triggerRadius, collision.blast);
+			for(const Body *body : collision.blast)
 				if(body == projectile.Target() || (gov->IsEnemy(body->GetGovernment())
 						&& reinterpret_cast<const Ship *>(body)->Cloaking() < 1.))
 				{
-					closestHit = 0.;
+					collision.closestHit = 0.;
 					break;
 				}
+		}
 
 		// If nothing triggered the projectile, check for collisions with ships.
-		if(closestHit > 0.)
+		if(collision.closestHit > 0.)
 		{
-			Ship *ship = reinterpret_cast<Ship *>(shipCollisions.Line(projectile, &closestHit));
+			Ship *ship = reinterpret_cast<Ship *>(shipCollisions.Line(projectile, &collision.closestHit));
 			if(ship)
 			{
-				hit = ship->shared_from_this();
-				hitVelocity = ship->Velocity();
+				collision.ship = ship;
+				collision.hitVelocity = ship->Velocity();
 			}
 		}
 		// "Phasing" projectiles can pass through asteroids. For all other
@@ -2153,34 +2535,58 @@ void Engine::DoCollisions(Projectile &projectile)
 		// ship that they have hit.
 		if(!projectile.GetWeapon().IsPhasing())
 		{
-			Body *asteroid = asteroids.Collide(projectile, &closestHit);
+			Body *asteroid = asteroids.Collide(projectile, &collision.closestHit, &collision.minable);
 			if(asteroid)
 			{
-				hitVelocity = asteroid->Velocity();
-				hit.reset();
+				collision.hitVelocity = asteroid->Velocity();
+				collision.ship = nullptr;
 			}
 		}
 	}
 
+	// If this projectile has a blast radius, find all ships within its radius.
+	// Even friendly ships can be hit by the blast.
+	double blastRadius = projectile.GetWeapon().BlastRadius();
+	if(collision.closestHit < 1. && blastRadius)
+	{
+		Point hitPos = projectile.Position() + collision.closestHit * projectile.Velocity();
+		shipCollisions.Circle(hitPos, blastRadius, collision.blast);
+	}
+	else
+		collision.blast.clear();
+}
+
+
+
+// Apply the effects of whatever the given projectile hit. Note that unlike the
+// preceding functions, this one adds any visuals that are created directly to
+// the main visuals list.
+void Engine::DoCollisions(Projectile &projectile, const Collision &collision)
+{
+	const Government *gov = projectile.GetGovernment();
+	shared_ptr<Ship> hit;
+	if(collision.ship)
+		hit = collision.ship->shared_from_this();
+	if(collision.minable)
+		collision.minable->TakeDamage(projectile);
+
 	// Check if the projectile hit something.
-	if(closestHit < 1.)
+	if(collision.closestHit < 1.)
 	{
 		// Create the explosion the given distance along the projectile's
 		// motion path for this step.
-		projectile.Explode(visuals, closestHit, hitVelocity);
+		projectile.Explode(visuals, collision.closestHit, collision.hitVelocity);
 
 		const DamageProfile damage(projectile.GetInfo());
 
-		// If this projectile has a blast radius, find all ships within its
+		// If this projectile has a blast radius, damage all ships within its
 		// radius. Otherwise, only one is damaged.
 		double blastRadius = projectile.GetWeapon().BlastRadius();
 		bool isSafe = projectile.GetWeapon().IsSafe();
 		if(blastRadius)
 		{
-			// Even friendly ships can be hit by the blast, unless it is a
-			// "safe" weapon.
-			Point hitPos = projectile.Position() + closestHit * projectile.Velocity();
-			for(Body *body : shipCollisions.Circle(hitPos, blastRadius))
+			// Friendly ships are not hit by the blast of a "safe" weapon.
+			for(Body *body : collision.blast)
 			{
 				Ship *ship = reinterpret_cast<Ship *>(body);
 				bool targeted = (projectile.Target() == ship);
@@ -2207,14 +2613,25 @@ void Engine::DoCollisions(Projectile &projectile)
 	else if(projectile.MissileStrength())
 	{
 		// If the projectile did not hit anything, give the anti-missile systems
-		// a chance to shoot it down.
-		for(Ship *ship : hasAntiMissile)
+		// a chance to shoot it down. Ships that are out of range would not fire,
+		// so only the nearby ones need to be checked, in their usual order.
+		antiMissileCollisions.Circle(projectile.Position(), maxAntiMissileRange, antiMissileNearby);
+		antiMissileIndices.clear();
+		for(const Body *body : antiMissileNearby)
+			antiMissileIndices.push_back(lower_bound(antiMissileOrder.begin(), antiMissileOrder.end(),
+				make_pair(body, size_t(0)))->second);
+		sort(antiMissileIndices.begin(), antiMissileIndices.end());
+
+		for(size_t index : antiMissileIndices)
+		{
+			Ship *ship = hasAntiMissile[index];
 			if(ship == projectile.Target() || gov->IsEnemy(ship->GetGovernment()))
 				if(ship->FireAntiMissile(projectile, visuals))
 				{
 					projectile.Kill();
 					break;
 				}
+		}
 	}
 }
 
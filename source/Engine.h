@@ -24,30 +24,38 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "Command.h"
 #include "DrawList.h"
 #include "EscortDisplay.h"
+#include "FrameArena.h"
 #include "Information.h"
 #include "Point.h"
 #include "Preferences.h"
 #include "Radar.h"
 #include "Rectangle.h"
+#include "ShipEvent.h"
+#include "StepTimings.h"
+#include "WorkerPool.h"
 
 #include <condition_variable>
+#include <cstdint>
 #include <list>
 #include <map>
 #include <memory>
+#include <string>
 #include <thread>
 #include <utility>
 #include <vector>
 
 class AlertLabel;
+class Body;
 class Flotsam;
 class Government;
+class Minable;
 class NPC;
 class Outfit;
 class PlanetLabel;
 class PlayerInfo;
 class Projectile;
+class Replay;
 class Ship;
-class ShipEvent;
 class Sprite;
 class TestContext;
 class Visual;
@@ -82,7 +90,7 @@ public:
 
 	// Get any special events that happened in this step.
 	// MainPanel::Step will clear this list.
-	std::list<ShipEvent> &Events();
+	std::vector<ShipEvent> &Events();
 
 	// Draw a frame.
 	void Draw() const;
@@ -90,6 +98,13 @@ public:
 	// Set the given TestContext in the next step of the Engine.
 	void SetTestContext(TestContext &newTestContext);
 
+	// Record the player's input from now until the engine is no longer active,
+	// starting from the given saved game. This must be called before Place().
+	void StartRecording(const std::string &savePath);
+	// Take the player's input from the given recording instead of from the
+	// keyboard and mouse. This must be called before Place().
+	void Play(const Replay &replay);
+
 	// Select the object the player clicked on.
 	void Click(const Point &from, const Point &to, bool hasShift, bool hasControl);
 	void RClick(const Point &point);
@@ -100,6 +115,12 @@ public:
 	// projectiles stop targeting gov.
 	void BreakTargeting(const Government *gov);
 
+	// Get a hash of the position and condition of every ship, projectile, and
+	// flotsam, to check whether two runs of the game ended in the same state.
+	uint64_t StateHash() const;
+	// Get how long each phase of the recent steps took, if timing is enabled.
+	const StepTimings &Timings() const;
+
 
 private:
 	class Target {
@@ -127,12 +148,27 @@ private:
 		double angle;
 	};
 
+	// What a projectile has hit in the current step.
+	class Collision {
+	public:
+		// How far along its path for this step the projectile hit something,
+		// or 1 if it did not hit anything.
+		double closestHit;
+		Point hitVelocity;
+		// The ship or minable asteroid that was hit, if any.
+		Ship *ship;
+		Minable *minable;
+		// If the projectile has a blast radius, all the ships it reaches.
+		std::vector<Body *> blast;
+	};
+
 
 private:
 	void EnterSystem();
 
 	void ThreadEntryPoint();
 	void CalculateStep();
+	void UpdateStepTimings();
 
 	void MoveShip(const std::shared_ptr<Ship> &ship);
 
@@ -143,10 +179,17 @@ private:
 	void HandleKeyboardInputs();
 	void HandleMouseClicks();
 	void HandleMouseInput(Command &activeCommands);
+	// Record the clicks and group selections handled in this step, or take
+	// them from the recording being played back.
+	void RecordOrReplayClicks();
+	void FinishRecording();
+	void SeedRandom(uint64_t seed);
 
 	void FillCollisionSets();
 
-	void DoCollisions(Projectile &projectile);
+	void DoCollisions();
+	void FindCollisions(const Projectile &projectile, Collision &collision) const;
+	void DoCollisions(Projectile &projectile, const Collision &collision);
 	void DoWeather(Weather &weather);
 	void DoCollection(Flotsam &flotsam);
 	void DoScanning(const std::shared_ptr<Ship> &ship);
@@ -177,9 +220,17 @@ private:
 	std::list<std::shared_ptr<Flotsam>> newFlotsam;
 	std::vector<Visual> newVisuals;
 
+	// What each projectile hit in this step, in the same order as the projectiles.
+	std::vector<Collision> collisions;
+
 	// Track which ships currently have anti-missiles ready to fire.
 	std::vector<Ship *> hasAntiMissile;
 
+	// Threads that help the calculation thread with work that can be split up.
+	WorkerPool workers;
+	// Memory for temporary lists, which the calculation thread frees all at
+	// once at the start of each step.
+	FrameArena frameArena;
 	AI ai;
 
 	std::thread calcThread;
@@ -219,13 +270,24 @@ private:
 
 	int step = 0;
 
-	std::list<ShipEvent> eventQueue;
-	std::list<ShipEvent> events;
+	// The events of this step and the last one. Both buffers are reused from
+	// one step to the next, so recording an event does not normally allocate.
+	std::vector<ShipEvent> eventQueue;
+	std::vector<ShipEvent> events;
 	// Keep track of who has asked for help in fighting whom.
 	std::map<const Government *, std::weak_ptr<const Ship>> grudge;
 	int grudgeTime = 0;
 
 	CollisionSet shipCollisions;
+	// The ships with anti-missiles ready to fire, so that each missile only
+	// needs to check the ones that might be in range of it. Each ship's place
+	// in hasAntiMissile is kept (sorted by address) so that they still get to
+	// fire in the same order as if every one of them were checked.
+	CollisionSet antiMissileCollisions;
+	std::vector<std::pair<const Body *, size_t>> antiMissileOrder;
+	std::vector<Body *> antiMissileNearby;
+	std::vector<size_t> antiMissileIndices;
+	double maxAntiMissileRange = 0.;
 
 	int alarmTime = 0;
 	double flash = 0.;
@@ -267,6 +329,28 @@ private:
 	double load = 0.;
 	int loadCount = 0;
 	double loadSum = 0.;
+	// How long the most recent step took to calculate, in seconds.
+	double stepTime = 0.;
+	// How many temporary lists the last step allocated from the frame arena,
+	// and how many new blocks the arena itself had to allocate from the heap.
+	// Other heap allocations made during the step are not counted.
+	size_t frameAllocations = 0;
+	size_t frameHeapAllocations = 0;
+	// How long each phase of the step took, which is only measured in debug
+	// mode, and the summary of those times that is drawn on screen.
+	StepTimings stepTimings;
+	std::vector<std::string> timingLines;
+	int timingDisplayCount = 0;
+
+	// The flight that is being recorded, or played back instead of reading the
+	// player's input, and how many of its steps have been played so far.
+	std::unique_ptr<Replay> recording;
+	const Replay *playback = nullptr;
+	size_t playbackStep = 0;
+	// The calculation thread has its own random number generator, which must
+	// be seeded in that thread in every step that is recorded or played back.
+	bool shouldSeedCalculation = false;
+	uint64_t calculationSeed = 0;
 };
 
 
@@ -0,0 +1,94 @@
+/* FrameArena.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "FrameArena.h"
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace std;
+
+namespace {
+	// The size of the first block, which is enough for a quiet system.
+	const size_t MIN_BLOCK_SIZE = 64 * 1024;
+}
+
+
+
+void *FrameArena::Allocate(size_t bytes, size_t alignment)
+{
+	++allocations;
+	uintptr_t address = reinterpret_cast<uintptr_t>(next);
+	size_t padding = (alignment - address % alignment) % alignment;
+	if(!next || static_cast<size_t>(end - next) < padding + bytes)
+	{
+		// Blocks come from new[], so they are aligned for any standard type.
+		AddBlock(max(max(2 * lastSize, MIN_BLOCK_SIZE), bytes));
+		padding = 0;
+	}
+
+	void *result = next + padding;
+	next += padding + bytes;
+	return result;
+}
+
+
+
+void FrameArena::Reset()
+{
+	allocations = 0;
+	heapAllocations = 0;
+
+	// If the last step needed more than one block, replace them with one that
+	// is big enough for all of them.
+	if(blocks.size() > 1)
+	{
+		size_t size = totalSize;
+		blocks.clear();
+		totalSize = 0;
+		AddBlock(size);
+	}
+	else if(!blocks.empty())
+	{
+		next = blocks.front().get();
+		end = next + totalSize;
+	}
+}
+
+
+
+size_t FrameArena::Allocations() const
+{
+	return allocations;
+}
+
+
+
+size_t FrameArena::HeapAllocations() const
+{
+	return heapAllocations;
+}
+
+
+
+void FrameArena::AddBlock(size_t size)
+{
+	++heapAllocations;
+	blocks.emplace_back(new char[size]);
+	totalSize += size;
+	lastSize = size;
+	next = blocks.back().get();
+	end = next + size;
+}
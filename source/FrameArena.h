@@ -0,0 +1,153 @@
+/* FrameArena.h
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef FRAME_ARENA_H_
+#define FRAME_ARENA_H_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+
+
+// Memory for temporary containers that only need to last for a single step of
+// the game. Allocations are carved out of large blocks and are never freed one
+// at a time; instead, everything is freed at once when the arena is reset at
+// the start of the next step. If a step needed more than one block, they are
+// replaced by a single block big enough for all of them, so once the arena has
+// grown to fit a typical step, it no longer touches the heap at all. An arena
+// is not thread-safe, so it must only be used by one thread at a time.
+class FrameArena {
+public:
+	FrameArena() = default;
+
+	// No moving or copying this class, since containers refer to it.
+	FrameArena(const FrameArena &other) = delete;
+	FrameArena &operator=(const FrameArena &other) = delete;
+
+	void *Allocate(size_t bytes, size_t alignment);
+	// Free everything that was allocated since the last reset.
+	void Reset();
+
+	// The number of allocations made since the last reset, and the number of
+	// those that needed a new block of memory from the heap.
+	size_t Allocations() const;
+	size_t HeapAllocations() const;
+
+
+private:
+	void AddBlock(size_t size);
+
+
+private:
+	std::vector<std::unique_ptr<char[]>> blocks;
+	size_t totalSize = 0;
+	size_t lastSize = 0;
+	char *next = nullptr;
+	char *end = nullptr;
+
+	size_t allocations = 0;
+	size_t heapAllocations = 0;
+};
+
+
+
+// A standard allocator that takes its memory from a FrameArena. The memory is
+// only reclaimed when the arena is reset, so a container using it must not
+// outlive the step it was created in.
+template <class T>
+class FrameAllocator {
+public:
+	using value_type = T;
+
+	explicit FrameAllocator(FrameArena &arena) noexcept;
+	template <class U>
+	FrameAllocator(const FrameAllocator<U> &other) noexcept;
+
+	T *allocate(size_t count);
+	void deallocate(T *pointer, size_t count) noexcept;
+
+	template <class U>
+	bool operator==(const FrameAllocator<U> &other) const noexcept;
+	template <class U>
+	bool operator!=(const FrameAllocator<U> &other) const noexcept;
+
+
+private:
+	FrameArena *arena;
+
+	template <class U>
+	friend class FrameAllocator;
+};
+
+
+
+// A vector whose storage comes from a FrameArena.
+template <class T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+
+
+template <class T>
+FrameAllocator<T>::FrameAllocator(FrameArena &arena) noexcept
+	: arena(&arena)
+{
+}
+
+
+
+template <class T>
+template <class U>
+FrameAllocator<T>::FrameAllocator(const FrameAllocator<U> &other) noexcept
+	: arena(other.arena)
+{
+}
+
+
+
+template <class T>
+T *FrameAllocator<T>::allocate(size_t count)
+{
+	return static_cast<T *>(arena->Allocate(count * sizeof(T), alignof(T)));
+}
+
+
+
+template <class T>
+void FrameAllocator<T>::deallocate(T *, size_t) noexcept
+{
+}
+
+
+
+template <class T>
+template <class U>
+bool FrameAllocator<T>::operator==(const FrameAllocator<U> &other) const noexcept
+{
+	return arena == other.arena;
+}
+
+
+
+template <class T>
+template <class U>
+bool FrameAllocator<T>::operator!=(const FrameAllocator<U> &other) const noexcept
+{
+	return arena != other.arena;
+}
+
+
+
+#endif
@@ -132,8 +132,12 @@ namespace {
 
 
 
-future<void> GameData::BeginLoad(bool onlyLoadData, bool debugMode)
+future<void> GameData::BeginLoad(bool onlyLoadData, bool debugMode, bool preventUpload)
 {
+	// Without a window, sprites are loaded only for their sizes and masks.
+	if(preventUpload)
+		spriteQueue.PreventUpload();
+
 	// Initialize the list of "source" folders based on any active plugins.
 	LoadSources();
 
@@ -75,7 +75,7 @@ class Wormhole;
 // universe.
 class GameData {
 public:
-	static std::future<void> BeginLoad(bool onlyLoadData, bool debugMode);
+	static std::future<void> BeginLoad(bool onlyLoadData, bool debugMode, bool preventUpload = false);
 	static void FinishLoading();
 	// Check for objects that are referred to but never defined.
 	static void CheckReferences();
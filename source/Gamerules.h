@@ -33,6 +33,7 @@ public:
 	int PersonSpawnPeriod() const;
 	int NoPersonSpawnWeight() const;
 	int NPCMaxMiningTime() const;
+	int RetargetInterval() const;
 	double UniversalFrugalThreshold() const;
 
 
@@ -41,6 +42,7 @@ private:
 	int personSpawnPeriod = 36000;
 	int noPersonSpawnWeight = 1000;
 	int npcMaxMiningTime = 3600;
+	int retargetInterval = 32;
 	double universalFrugalThreshold = .75;
 };
 
@@ -156,6 +156,9 @@ public:
 
 
 private:
+	// Politics keeps a table of which governments are enemies, indexed by ID.
+	friend class Politics;
+
 	unsigned id;
 	std::string name;
 	std::string displayName;
@@ -0,0 +1,244 @@
+/* HeadlessSimulation.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "HeadlessSimulation.h"
+
+#include "Engine.h"
+#include "Files.h"
+#include "text/Format.h"
+#include "GameData.h"
+#include "Logger.h"
+#include "PlayerInfo.h"
+#include "Random.h"
+#include "Replay.h"
+#include "ShipEvent.h"
+#include "StepTimings.h"
+#include "TestData.h"
+#include "UI.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+using namespace std;
+
+namespace {
+	// Load the saved game to simulate, returning false if there is none.
+	bool LoadSave(PlayerInfo &player, const string &save)
+	{
+		if(save.empty())
+			return player.LoadRecent();
+
+		string path = save;
+		if(!Files::Exists(path))
+		{
+			// Savegames in the test data are written to the saves directory
+			// before being loaded, just like when a test injects them.
+			const TestData *testData = GameData::TestDataSets().Find(save);
+			if(!testData || !testData->Inject())
+				return false;
+			path = Files::Saves() + save + ".txt";
+		}
+		player.Load(path);
+		return player.IsLoaded();
+	}
+
+
+
+	// Take off from wherever the loaded game left the player.
+	bool TakeOff(PlayerInfo &player, UI &ui)
+	{
+		if(!player.GetSystem() || !player.Flagship())
+		{
+			Logger::LogError("The saved game to simulate has no flagship in a system.");
+			return false;
+		}
+		if(player.GetPlanet() && !player.TakeOff(&ui))
+		{
+			Logger::LogError("The player's fleet was unable to take off.");
+			return false;
+		}
+		return true;
+	}
+
+
+
+	string Milliseconds(double time)
+	{
+		return Format::Decimal(time, 3) + " ms";
+	}
+
+
+
+	// Print how long the given steps took, in total and in each phase.
+	void PrintTimes(const Engine &engine, vector<double> &stepTimes, double total)
+	{
+		cout << "Simulated " << stepTimes.size() << " steps in " << Format::Decimal(total, 3) << " seconds";
+		if(total > 0.)
+			cout << " (" << Format::Decimal(stepTimes.size() / total, 1) << " steps per second)";
+		cout << "." << endl;
+		if(!stepTimes.empty())
+		{
+			sort(stepTimes.begin(), stepTimes.end());
+			double sum = 0.;
+			for(double time : stepTimes)
+				sum += time;
+			size_t p99 = max<size_t>(static_cast<size_t>(ceil(.99 * stepTimes.size())), 1) - 1;
+			cout << "Step time: min " << Milliseconds(stepTimes.front())
+				<< ", avg " << Milliseconds(sum / stepTimes.size())
+				<< ", p99 " << Milliseconds(stepTimes[p99])
+				<< ", max " << Milliseconds(stepTimes.back()) << endl;
+		}
+
+		const StepTimings &timings = engine.Timings();
+		cout << "Phase times (min / avg / p99):" << endl;
+		for(size_t phase = 0; phase < timings.PhaseCount(); ++phase)
+		{
+			StepTimings::Stats stats = timings.GetStats(phase);
+			cout << "    " << timings.PhaseName(phase) << ": " << Milliseconds(stats.min)
+				<< " / " << Milliseconds(stats.average) << " / " << Milliseconds(stats.p99) << endl;
+		}
+	}
+}
+
+
+
+int HeadlessSimulation::Run(PlayerInfo &player, const string &save, int steps)
+{
+	GameData::FinishLoadingSprites();
+	GameData::FinishLoading();
+
+	if(!LoadSave(player, save))
+	{
+		Logger::LogError("Unable to load the saved game to simulate.");
+		return 1;
+	}
+	// The UI is never drawn, but taking off may try to show dialogs in it.
+	UI ui;
+	if(!TakeOff(player, ui))
+		return 1;
+
+	// Make the random numbers used on this thread repeatable, so that the same
+	// save run for the same number of steps always ends in the same state.
+	Random::Seed(0);
+	StepTimings::SetEnabled(true);
+
+	Engine engine(player);
+	engine.Place();
+
+	vector<double> stepTimes;
+	stepTimes.reserve(steps);
+	chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+	for(int i = 0; i < steps; ++i)
+	{
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		engine.Go();
+		engine.Wait();
+		stepTimes.push_back(chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+		engine.Step(true);
+	}
+	PrintTimes(engine, stepTimes, chrono::duration<double>(chrono::steady_clock::now() - begin).count());
+
+	ostringstream hash;
+	hash << hex << setw(16) << setfill('0') << engine.StateHash();
+	cout << "Final state hash: " << hash.str() << endl;
+	return 0;
+}
+
+
+
+int HeadlessSimulation::Play(PlayerInfo &player, const string &path)
+{
+	GameData::FinishLoadingSprites();
+	GameData::FinishLoading();
+
+	Replay replay;
+	if(!replay.Load(path))
+	{
+		Logger::LogError("\"" + path + "\" is not a valid recording.");
+		return 1;
+	}
+	// The ships must behave the same way they did when this was recorded. The
+	// changed preferences are not saved, because the game is not shown.
+	replay.ApplyPreferences();
+	// The recorded game is not written to the saves directory, so that it does
+	// not show up as one of the player's pilots.
+	string savePath = Files::Config() + "replay save.txt";
+	replay.WriteSave(savePath);
+	player.Load(savePath);
+	UI ui;
+	if(!player.IsLoaded() || !TakeOff(player, ui))
+		return 1;
+
+	StepTimings::SetEnabled(true);
+	Engine engine(player);
+	engine.Play(replay);
+	engine.Place();
+
+	// Step the engine the same way MainPanel does, checking the state of the
+	// game against the recording before each step's input is handled.
+	const vector<Replay::Step> &steps = replay.Steps();
+	size_t mismatch = steps.size();
+	vector<double> stepTimes;
+	stepTimes.reserve(steps.size());
+	chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+	for(size_t i = 0; i < steps.size(); ++i)
+	{
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		engine.Go();
+		engine.Wait();
+		stepTimes.push_back(chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+		if(engine.StateHash() != steps[i].checksum)
+		{
+			mismatch = i;
+			break;
+		}
+		engine.Step(true);
+
+		// The events of the step right after taking off are never handled.
+		if(i)
+			for(const ShipEvent &event : engine.Events())
+				player.HandleEvent(event, &ui);
+		engine.Events().clear();
+	}
+	PrintTimes(engine, stepTimes, chrono::duration<double>(chrono::steady_clock::now() - begin).count());
+
+	if(mismatch < steps.size())
+	{
+		cout << "The game state no longer matches the recording in step " << mismatch << " of " << steps.size()
+			<< "." << endl;
+		return 1;
+	}
+	cout << "The game state matched the recording in all " << steps.size() << " steps." << endl;
+	return 0;
+}
+
+
+
+void HeadlessSimulation::Help()
+{
+	cerr << "    --simulate <steps>: take off and run the given number of steps without a window, then print"
+			<< " how long they took and a hash of the final state." << endl;
+	cerr << "        --save <path|name>: simulate the given saved game, or a savegame from the test data,"
+			<< " instead of the most recent one." << endl;
+	cerr << "    --record <path>: record each flight, from taking off until the game is interrupted, to the given file."
+			<< endl;
+	cerr << "    --replay <path>: play back a recorded flight without a window, checking that the game state matches"
+			<< " the recording in every step." << endl;
+}
@@ -0,0 +1,45 @@
+/* HeadlessSimulation.h
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef HEADLESS_SIMULATION_H_
+#define HEADLESS_SIMULATION_H_
+
+#include <string>
+
+class PlayerInfo;
+
+
+
+// Class for running the game without a window or a graphics context, as fast as
+// possible, so that combat can be profiled or batch-tested on a machine with no
+// display. The player takes off from wherever the saved game left them, and the
+// engine is stepped a fixed number of times without anything being drawn.
+// Afterwards, statistics about how long the steps took and a hash of the final
+// state are printed to the console.
+class HeadlessSimulation {
+public:
+	// Run the given number of steps. The saved game is either a path to a file,
+	// the name of a savegame in the test data, or empty to use the most recent
+	// save. The game data must already be loaded. Returns the exit code.
+	static int Run(PlayerInfo &player, const std::string &save, int steps);
+	// Play back a recorded flight, checking that the state of the game matches
+	// the recording in every step. Returns the exit code.
+	static int Play(PlayerInfo &player, const std::string &path);
+	static void Help();
+};
+
+
+
+#endif
@@ -283,11 +283,11 @@ void ImageSet::Load() noexcept(false)
 // Create the sprite and upload the image data to the GPU. After this is
 // called, the internal image buffers and mask vector will be cleared, but
 // the paths are saved in case the sprite needs to be loaded again.
-void ImageSet::Upload(Sprite *sprite)
+void ImageSet::Upload(Sprite *sprite, bool preventUpload)
 {
 	// Load the frames (this will clear the buffers).
-	sprite->AddFrames(buffer[0], false);
-	sprite->AddFrames(buffer[1], true);
+	sprite->AddFrames(buffer[0], false, preventUpload);
+	sprite->AddFrames(buffer[1], true, preventUpload);
 	GameData::GetMaskManager().SetMasks(sprite, std::move(masks));
 	masks.clear();
 }
@@ -62,8 +62,9 @@ public:
 	void Load() noexcept(false);
 	// Create the sprite and upload the image data to the GPU. After this is
 	// called, the internal image buffers and mask vector will be cleared, but
-	// the paths are saved in case the sprite needs to be loaded again.
-	void Upload(Sprite *sprite);
+	// the paths are saved in case the sprite needs to be loaded again. If
+	// uploading is prevented, the sprite only gets its dimensions and masks.
+	void Upload(Sprite *sprite, bool preventUpload = false);
 
 
 private:
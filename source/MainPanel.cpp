@@ -20,6 +20,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "CategoryList.h"
 #include "CoreStartData.h"
 #include "Dialog.h"
+#include "Files.h"
 #include "text/Font.h"
 #include "text/FontSet.h"
 #include "text/Format.h"
@@ -38,6 +39,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "PlayerInfoPanel.h"
 #include "Preferences.h"
 #include "Random.h"
+#include "Replay.h"
 #include "Screen.h"
 #include "Ship.h"
 #include "ShipEvent.h"
@@ -48,8 +50,10 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "opengl.h"
 
 #include <cmath>
+#include <iterator>
 #include <sstream>
 #include <string>
+#include <vector>
 
 using namespace std;
 
@@ -144,9 +148,12 @@ void MainPanel::Step()
 
 	engine.Step(isActive);
 
-	// Splice new events onto the eventQueue for (eventual) handling. No
-	// other classes use Engine::Events() after Engine::Step() completes.
-	eventQueue.splice(eventQueue.end(), engine.Events());
+	// Move new events onto the eventQueue for (eventual) handling. No other
+	// classes use Engine::Events() after Engine::Step() completes, so it can
+	// be emptied for the engine to reuse.
+	vector<ShipEvent> &newEvents = engine.Events();
+	eventQueue.insert(eventQueue.end(), make_move_iterator(newEvents.begin()), make_move_iterator(newEvents.end()));
+	newEvents.clear();
 	// Handle as many ShipEvents as possible (stopping if no longer active
 	// and updating the isActive flag).
 	StepEvents(isActive);
@@ -202,6 +209,10 @@ void MainPanel::Draw()
 // The planet panel calls this when it closes.
 void MainPanel::OnCallback()
 {
+	// If asked to, record this flight. The planet panel has just saved the
+	// game, so that is what the recording starts from.
+	if(!Replay::RecordPath().empty())
+		engine.StartRecording(Files::Saves() + player.Identifier() + ".txt");
 	engine.Place();
 	// Run one step of the simulation to fill in the new planet locations.
 	engine.Go();
@@ -505,9 +516,10 @@ bool MainPanel::ShowHailPanel()
 // oldest and then process events until any create a new UI element.
 void MainPanel::StepEvents(bool &isActive)
 {
-	while(isActive && !eventQueue.empty())
+	size_t handled = 0;
+	while(isActive && handled < eventQueue.size())
 	{
-		const ShipEvent &event = eventQueue.front();
+		const ShipEvent &event = eventQueue[handled];
 		const Government *actor = event.ActorGovernment();
 
 		// Pass this event to the player, to update conditions and make
@@ -586,8 +598,9 @@ void MainPanel::StepEvents(bool &isActive)
 			}
 		}
 
-		// Remove the fully-handled event.
-		eventQueue.pop_front();
+		// Move on from the fully-handled event.
+		++handled;
 		handledFront = false;
 	}
+	eventQueue.erase(eventQueue.begin(), eventQueue.begin() + handled);
 }
@@ -20,11 +20,11 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 
 #include "Command.h"
 #include "Engine.h"
+#include "ShipEvent.h"
 
-#include <list>
+#include <vector>
 
 class PlayerInfo;
-class ShipEvent;
 
 
 
@@ -73,7 +73,7 @@ private:
 	Engine engine;
 
 	// These are the pending ShipEvents that have yet to be processed.
-	std::list<ShipEvent> eventQueue;
+	std::vector<ShipEvent> eventQueue;
 	bool handledFront = false;
 
 	Command show;
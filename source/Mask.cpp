@@ -25,6 +25,32 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 using namespace std;
 
 namespace {
+	// The number of consecutive edges grouped into each bounding box.
+	const size_t BLOCK_SIZE = 8;
+	// Queries pad their bounding boxes by this many pixels, so that rounding
+	// errors can never cause a block to be skipped that might have passed the
+	// exact test for one of its edges.
+	const double BLOCK_PADDING = 1.;
+
+	// Find the squared distances from the given point to the nearest and
+	// farthest parts of a (padded) bounding box.
+	template <class Block>
+	void BoxDistances(const Block &block, Point point, double &nearSquared, double &farSquared)
+	{
+		double minX = block.minX - BLOCK_PADDING - point.X();
+		double maxX = block.maxX + BLOCK_PADDING - point.X();
+		double minY = block.minY - BLOCK_PADDING - point.Y();
+		double maxY = block.maxY + BLOCK_PADDING - point.Y();
+		double nearX = max(0., max(minX, -maxX));
+		double nearY = max(0., max(minY, -maxY));
+		double farX = max(-minX, maxX);
+		double farY = max(-minY, maxY);
+		nearSquared = nearX * nearX + nearY * nearY;
+		farSquared = farX * farX + farY * farY;
+	}
+
+
+
 	// Trace out outlines from an image frame.
 	void Trace(const ImageBuffer &image, int frame, vector<vector<Point>> &raw)
 	{
@@ -289,7 +315,10 @@ void Mask::Create(const ImageBuffer &image, int frame)
 	vector<vector<Point>> raw;
 	Trace(image, frame, raw);
 	if(raw.empty())
+	{
+		BuildBlocks();
 		return;
+	}
 
 	outlines.reserve(raw.size());
 	for(auto &edge : raw)
@@ -306,6 +335,7 @@ void Mask::Create(const ImageBuffer &image, int frame)
 		outlines.back().shrink_to_fit();
 	}
 	outlines.shrink_to_fit();
+	BuildBlocks();
 }
 
 
@@ -379,13 +409,22 @@ bool Mask::WithinRing(Point point, Angle facing, double inner, double outer) con
 	inner *= inner;
 	outer *= outer;
 
-	for(auto &&outline : outlines)
-		for(auto &&p : outline)
+	// Every vertex is the start point of exactly one edge.
+	for(const EdgeBlock &block : blocks)
+	{
+		double nearSquared;
+		double farSquared;
+		BoxDistances(block, point, nearSquared, farSquared);
+		if(nearSquared >= outer || farSquared <= inner)
+			continue;
+
+		for(size_t i = block.begin; i < block.end; ++i)
 		{
-			double pSquared = p.DistanceSquared(point);
+			double pSquared = Point(startX[i], startY[i]).DistanceSquared(point);
 			if(pSquared < outer && pSquared > inner)
 				return true;
 		}
+	}
 
 	return false;
 }
@@ -404,9 +443,18 @@ double Mask::Range(Point point, Angle facing) const
 	if(Contains(point))
 		return 0.;
 
-	for(auto &&outline : outlines)
-		for(auto &&p : outline)
-			range = min(range, p.Distance(point));
+	// Every vertex is the start point of exactly one edge.
+	for(const EdgeBlock &block : blocks)
+	{
+		double nearSquared;
+		double farSquared;
+		BoxDistances(block, point, nearSquared, farSquared);
+		if(nearSquared > range * range)
+			continue;
+
+		for(size_t i = block.begin; i < block.end; ++i)
+			range = min(range, Point(startX[i], startY[i]).Distance(point));
+	}
 
 	return range;
 }
@@ -435,6 +483,7 @@ Mask Mask::operator*(double scale) const
 		for(Point &p : outline)
 			p *= scale;
 	newMask.radius *= scale;
+	newMask.BuildBlocks();
 	return newMask;
 }
 
@@ -452,29 +501,42 @@ double Mask::Intersection(Point sA, Point vA) const
 	// Keep track of the closest intersection point found.
 	double closest = 1.;
 
-	for(auto &&outline : outlines)
+	// An edge can only be crossed if its bounding box overlaps the segment's.
+	Point sB = sA + vA;
+	double minX = min(sA.X(), sB.X()) - BLOCK_PADDING;
+	double maxX = max(sA.X(), sB.X()) + BLOCK_PADDING;
+	double minY = min(sA.Y(), sB.Y()) - BLOCK_PADDING;
+	double maxY = max(sA.Y(), sB.Y()) + BLOCK_PADDING;
+	const double aX = vA.X();
+	const double aY = vA.Y();
+	const double sX = sA.X();
+	const double sY = sA.Y();
+	for(const EdgeBlock &block : blocks)
 	{
-		Point prev = outline.back();
-		for(auto &&next : outline)
+		if(block.maxX < minX || block.minX > maxX || block.maxY < minY || block.minY > maxY)
+			continue;
+
+		for(size_t i = block.begin; i < block.end; ++i)
 		{
 			// Check if there is an intersection. (If not, the cross would be 0.) If
 			// there is, handle it only if it is a point where the segment is
 			// entering the polygon rather than exiting it (i.e. cross > 0).
-			Point vB = next - prev;
-			double cross = vB.Cross(vA);
+			// This is the same arithmetic as Point::Cross(), written out.
+			double bX = endX[i] - startX[i];
+			double bY = endY[i] - startY[i];
+			double cross = bX * aY - bY * aX;
 			if(cross > 0.)
 			{
-				Point vS = prev - sA;
-				double uB = vA.Cross(vS);
-				double uA = vB.Cross(vS);
+				double vX = startX[i] - sX;
+				double vY = startY[i] - sY;
+				double uB = aX * vY - aY * vX;
+				double uA = bX * vY - bY * vX;
 				// If the intersection occurs somewhere within this segment of the
 				// outline, find out how far along the query vector it occurs and
 				// remember it if it is the closest so far.
 				if((uB >= 0.) & (uB < cross) & (uA >= 0.))
 					closest = min(closest, uA / cross);
 			}
-
-			prev = next;
 		}
 	}
 	return closest;
@@ -497,21 +559,62 @@ bool Mask::Contains(Point point) const
 	// Compute the number of intersections across all outlines, not just one, as the
 	// outlines may be nested (i.e. holes) or discontinuous (multiple separate shapes).
 	int intersections = 0;
-	for(auto &&outline : outlines)
+	const double x = point.X();
+	for(const EdgeBlock &block : blocks)
 	{
-		Point prev = outline.back();
-		for(auto &&next : outline)
-		{
-			if(prev.X() != next.X())
-				if((prev.X() <= point.X()) == (point.X() < next.X()))
+		if(x < block.minX || x > block.maxX)
+			continue;
+
+		for(size_t i = block.begin; i < block.end; ++i)
+			if(startX[i] != endX[i])
+				if((startX[i] <= x) == (x < endX[i]))
 				{
-					double y = prev.Y() + (next.Y() - prev.Y()) *
-						(point.X() - prev.X()) / (next.X() - prev.X());
+					double y = startY[i] + (endY[i] - startY[i]) *
+						(x - startX[i]) / (endX[i] - startX[i]);
 					intersections += (y >= point.Y());
 				}
-			prev = next;
-		}
 	}
 	// If the number of intersections is odd, the point is within the mask.
 	return (intersections & 1);
 }
+
+
+
+void Mask::BuildBlocks()
+{
+	startX.clear();
+	startY.clear();
+	endX.clear();
+	endY.clear();
+	blocks.clear();
+
+	for(const vector<Point> &outline : outlines)
+	{
+		Point prev = outline.back();
+		for(const Point &next : outline)
+		{
+			// Start a new block at the beginning of each outline, or once the
+			// current one is full.
+			size_t index = startX.size();
+			if(&next == &outline.front() || index - blocks.back().begin == BLOCK_SIZE)
+				blocks.push_back(EdgeBlock{prev.X(), prev.Y(), prev.X(), prev.Y(), index, index});
+			EdgeBlock &block = blocks.back();
+			block.minX = min(block.minX, min(prev.X(), next.X()));
+			block.minY = min(block.minY, min(prev.Y(), next.Y()));
+			block.maxX = max(block.maxX, max(prev.X(), next.X()));
+			block.maxY = max(block.maxY, max(prev.Y(), next.Y()));
+			block.end = index + 1;
+
+			startX.push_back(prev.X());
+			startY.push_back(prev.Y());
+			endX.push_back(next.X());
+			endY.push_back(next.Y());
+			prev = next;
+		}
+	}
+	startX.shrink_to_fit();
+	startY.shrink_to_fit();
+	endX.shrink_to_fit();
+	endY.shrink_to_fit();
+	blocks.shrink_to_fit();
+}
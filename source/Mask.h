@@ -19,6 +19,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "Angle.h"
 #include "Point.h"
 
+#include <cstddef>
 #include <vector>
 
 class ImageBuffer;
@@ -69,11 +70,36 @@ public:
 private:
 	double Intersection(Point sA, Point vA) const;
 	bool Contains(Point point) const;
+	// Regroup the outlines' edges into blocks. This must be done whenever the
+	// outlines change.
+	void BuildBlocks();
+
+
+private:
+	// A run of consecutive edges from one outline, along with the bounding box
+	// of their end points. Queries skip any block whose box they cannot reach.
+	class EdgeBlock {
+	public:
+		double minX;
+		double minY;
+		double maxX;
+		double maxY;
+		size_t begin;
+		size_t end;
+	};
 
 
 private:
 	std::vector<std::vector<Point>> outlines;
 	double radius = 0.;
+
+	// The end points of every edge of every outline, stored as separate arrays
+	// so that the edge tests read each block's edges from contiguous memory.
+	std::vector<double> startX;
+	std::vector<double> startY;
+	std::vector<double> endX;
+	std::vector<double> endY;
+	std::vector<EdgeBlock> blocks;
 };
 
 
@@ -23,6 +23,15 @@ using namespace std;
 namespace {
 	constexpr double DEFAULT = 1.;
 	map<const Sprite *, bool> warned;
+	// Masks may be looked up from several threads at once.
+	mutex warnedMutex;
+
+	// Check whether a warning about the given sprite's masks has yet to be given.
+	bool ShouldWarn(const Sprite *sprite)
+	{
+		lock_guard<mutex> lock(warnedMutex);
+		return warned.insert(make_pair(sprite, true)).second;
+	}
 
 	string PrintScale(double s)
 	{
@@ -99,7 +108,7 @@ const std::vector<Mask> &MaskManager::GetMasks(const Sprite *sprite, double scal
 	const auto scalesIt = spriteMasks.find(sprite);
 	if(scalesIt == spriteMasks.end())
 	{
-		if(warned.insert(make_pair(sprite, true)).second)
+		if(ShouldWarn(sprite))
 			Logger::LogError("Warning: sprite \"" + sprite->Name() + "\": no collision masks found.");
 		return EMPTY;
 	}
@@ -110,7 +119,7 @@ const std::vector<Mask> &MaskManager::GetMasks(const Sprite *sprite, double scal
 		return maskIt->second;
 
 	// Shouldn't happen, but just in case, print some details about the scales for this sprite (once).
-	if(warned.insert(make_pair(sprite, true)).second)
+	if(ShouldWarn(sprite))
 	{
 		string warning = "Warning: sprite \"" + sprite->Name() + "\": collision mask not found.";
 		if(scales.empty()) warning += " (No scaled masks.)";
@@ -60,6 +60,7 @@ namespace {
 // Reset to the initial political state defined in the game data.
 void Politics::Reset()
 {
+	hostilityChanged = true;
 	reputationWith.clear();
 	dominatedPlanets.clear();
 	ResetDaily();
@@ -76,6 +77,35 @@ void Politics::Reset()
 
 
 bool Politics::IsEnemy(const Government *first, const Government *second) const
+{
+	if(!hostilityChanged && first && second && first->id < hostilitySize && second->id < hostilitySize)
+		return hostility[first->id * hostilitySize + second->id];
+
+	return FindEnemy(first, second);
+}
+
+
+
+void Politics::UpdateHostility()
+{
+	if(!hostilityChanged)
+		return;
+
+	hostilitySize = 0;
+	for(const auto &it : GameData::Governments())
+		hostilitySize = max(hostilitySize, it.second.id + 1);
+
+	hostility.assign(hostilitySize * hostilitySize, false);
+	for(const auto &first : GameData::Governments())
+		for(const auto &second : GameData::Governments())
+			hostility[first.second.id * hostilitySize + second.second.id] = FindEnemy(&first.second, &second.second);
+
+	hostilityChanged = false;
+}
+
+
+
+bool Politics::FindEnemy(const Government *first, const Government *second) const
 {
 	if(first == second)
 		return false;
@@ -111,6 +141,8 @@ void Politics::Offend(const Government *gov, int eventType, int count)
 	if(gov->IsPlayer())
 		return;
 
+	hostilityChanged = true;
+
 	for(const auto &it : GameData::Governments())
 	{
 		const Government *other = &it.second;
@@ -148,6 +180,7 @@ void Politics::Offend(const Government *gov, int eventType, int count)
 // Bribe the given government to be friendly to you for one day.
 void Politics::Bribe(const Government *gov)
 {
+	hostilityChanged = true;
 	bribed.insert(gov);
 	provoked.erase(gov);
 	fined.insert(gov);
@@ -344,6 +377,7 @@ void Politics::SetReputation(const Government *gov, double value)
 	value = min(value, gov->ReputationMax());
 	value = max(value, gov->ReputationMin());
 	reputationWith[gov] = value;
+	hostilityChanged = true;
 }
 
 
@@ -351,6 +385,7 @@ void Politics::SetReputation(const Government *gov, double value)
 // Reset any temporary provocation (typically because a day has passed).
 void Politics::ResetDaily()
 {
+	hostilityChanged = true;
 	provoked.clear();
 	bribed.clear();
 	bribedPlanets.clear();
@@ -16,9 +16,11 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #ifndef POLITICS_H_
 #define POLITICS_H_
 
+#include <atomic>
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 class Government;
 class Planet;
@@ -37,6 +39,11 @@ public:
 	void Reset();
 
 	bool IsEnemy(const Government *first, const Government *second) const;
+	// Work out ahead of time which governments are enemies, so that IsEnemy()
+	// only has to look up the answer. This does nothing unless something has
+	// changed since the last time, and until it is called again after a change,
+	// IsEnemy() works out the answer from scratch instead.
+	void UpdateHostility();
 
 	// Commit the given "offense" against the given government (which may not
 	// actually consider it to be an offense). This may result in temporary
@@ -69,6 +76,10 @@ public:
 	void ResetDaily();
 
 
+private:
+	bool FindEnemy(const Government *first, const Government *second) const;
+
+
 private:
 	// attitude[target][other] stores how much an action toward the given target
 	// government will affect your reputation with the given other government.
@@ -81,6 +92,12 @@ private:
 	std::map<const Planet *, bool> bribedPlanets;
 	std::set<const Planet *> dominatedPlanets;
 	std::set<const Government *> fined;
+
+	// hostility[first * hostilitySize + second] is true if the governments with
+	// those IDs are enemies.
+	std::vector<bool> hostility;
+	unsigned hostilitySize = 0;
+	std::atomic<bool> hostilityChanged{true};
 };
 
 
@@ -43,6 +43,14 @@ namespace {
 		else
 			return Random::Real() > (tracking * distance) / (sqrt(jamming) * weaponRange);
 	}
+
+	// Check if projectiles of this weapon always fly in a straight line at a
+	// constant speed, with nothing to do along the way but move.
+	bool Coasts(const Weapon &weapon)
+	{
+		return !weapon.Homing() && !weapon.Turn() && !weapon.Acceleration() && !weapon.SplitRange()
+			&& weapon.LiveEffects().empty();
+	}
 }
 
 
@@ -60,6 +68,7 @@ Projectile::Projectile(const Ship &parent, Point position, Angle angle, const We
 	cachedTarget = TargetPtr().get();
 	if(cachedTarget)
 		targetGovernment = cachedTarget->GetGovernment();
+	coasts = Coasts(*weapon);
 
 	dV = this->angle.Unit() * (weapon->Velocity() + Random::Real() * weapon->RandomVelocity());
 	velocity += dV;
@@ -80,6 +89,7 @@ Projectile::Projectile(const Projectile &parent, const Point &offset, const Angl
 	targetGovernment = parent.targetGovernment;
 
 	cachedTarget = TargetPtr().get();
+	coasts = Coasts(*weapon);
 
 	// Given that submunitions inherit the velocity of the parent projectile,
 	// it is often the case that submunitions don't add any additional velocity.
@@ -135,10 +145,13 @@ void Projectile::Move(vector<Visual> &visuals, vector<Projectile> &projectiles)
 
 	// If the target has left the system, stop following it. Also stop if the
 	// target has been captured by a different government.
+	// The cached pointer is valid for as long as the target exists, which is
+	// much cheaper to check than locking the target.
 	const Ship *target = cachedTarget;
 	if(target)
 	{
-		target = TargetPtr().get();
+		if(targetShip.expired())
+			target = nullptr;
 		if(!target || !target->IsTargetable() || target->GetGovernment() != targetGovernment)
 		{
 			targetShip.reset();
@@ -147,6 +160,14 @@ void Projectile::Move(vector<Visual> &visuals, vector<Projectile> &projectiles)
 		}
 	}
 
+	// Most projectiles skip all the steering and acceleration below.
+	if(coasts)
+	{
+		position += velocity;
+		distanceTraveled += dV.Length();
+		return;
+	}
+
 	double turn = weapon->Turn();
 	double accel = weapon->Acceleration();
 	int homing = weapon->Homing();
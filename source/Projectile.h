@@ -115,6 +115,9 @@ private:
 	int lifetime = 0;
 	double distanceTraveled = 0;
 	bool hasLock = true;
+	// Whether this projectile's weapon never steers, accelerates, or creates
+	// effects while it flies, so that moving it is simple.
+	bool coasts = false;
 };
 
 
@@ -18,24 +18,54 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include <random>
 
 #ifndef __linux__
+#include <map>
 #include <mutex>
+#include <thread>
 #endif
 
 using namespace std;
 
-// Right now thread_local storage is only supported under Linux.
 namespace {
+	// Each thread has its own generator, so that the numbers drawn by one
+	// thread do not depend on what the other threads are doing.
+	class Generator {
+	public:
+		mt19937_64 gen;
+		uniform_int_distribution<uint32_t> uniform;
+		uniform_real_distribution<double> real;
+		normal_distribution<double> normal;
+	};
+
+// Right now thread_local storage is only supported under Linux, so elsewhere
+// the generators are looked up by thread instead.
 #ifndef __linux__
 	mutex workaroundMutex;
-	mt19937_64 gen;
-	uniform_int_distribution<uint32_t> uniform;
-	uniform_real_distribution<double> real;
-	normal_distribution<double> normal;
+	map<thread::id, Generator> generators;
+
+	// The caller must hold the lock.
+	Generator &ThisThread()
+	{
+		return generators[this_thread::get_id()];
+	}
 #else
-	thread_local mt19937_64 gen;
-	thread_local uniform_int_distribution<uint32_t> uniform;
-	thread_local uniform_real_distribution<double> real;
-	thread_local normal_distribution<double> normal;
+	thread_local Generator generator;
+
+	Generator &ThisThread()
+	{
+		return generator;
+	}
+#endif
+}
+
+
+
+// With thread_local storage, a thread's generator is freed when it exits.
+// Otherwise, it has to be removed from the map of generators by hand.
+Random::ThreadGuard::~ThreadGuard()
+{
+#ifndef __linux__
+	lock_guard<mutex> lock(workaroundMutex);
+	generators.erase(this_thread::get_id());
 #endif
 }
 
@@ -48,7 +78,7 @@ void Random::Seed(uint64_t seed)
 #ifndef __linux__
 	lock_guard<mutex> lock(workaroundMutex);
 #endif
-	gen.seed(seed);
+	ThisThread().gen.seed(seed);
 }
 
 
@@ -58,7 +88,8 @@ uint32_t Random::Int()
 #ifndef __linux__
 	lock_guard<mutex> lock(workaroundMutex);
 #endif
-	return uniform(gen);
+	Generator &generator = ThisThread();
+	return generator.uniform(generator.gen);
 }
 
 
@@ -68,7 +99,8 @@ uint32_t Random::Int(uint32_t upper_bound)
 #ifndef __linux__
 	lock_guard<mutex> lock(workaroundMutex);
 #endif
-	const uint32_t x = uniform(gen);
+	Generator &generator = ThisThread();
+	const uint32_t x = generator.uniform(generator.gen);
 	return (static_cast<uint64_t>(x) * static_cast<uint64_t>(upper_bound)) >> 32;
 }
 
@@ -79,7 +111,8 @@ double Random::Real()
 #ifndef __linux__
 	lock_guard<mutex> lock(workaroundMutex);
 #endif
-	return real(gen);
+	Generator &generator = ThisThread();
+	return generator.real(generator.gen);
 }
 
 
@@ -92,7 +125,7 @@ uint32_t Random::Polya(uint32_t k, double p)
 #ifndef __linux__
 	lock_guard<mutex> lock(workaroundMutex);
 #endif
-	return polya(gen);
+	return polya(ThisThread().gen);
 }
 
 
@@ -104,7 +137,7 @@ uint32_t Random::Binomial(uint32_t t, double p)
 #ifndef __linux__
 	lock_guard<mutex> lock(workaroundMutex);
 #endif
-	return binomial(gen);
+	return binomial(ThisThread().gen);
 }
 
 
@@ -115,5 +148,6 @@ double Random::Normal(double mean, double sigma)
 #ifndef __linux__
 	lock_guard<mutex> lock(workaroundMutex);
 #endif
-	return sigma * normal(gen) + mean;
+	Generator &generator = ThisThread();
+	return sigma * generator.normal(generator.gen) + mean;
 }
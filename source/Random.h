@@ -24,9 +24,22 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 // different distributions. (This is done partly because on some systems the
 // random number generation is not thread-safe.)
 class Random {
+public:
+	// A thread other than the main thread that draws random numbers should
+	// hold one of these for as long as it runs, so that its generator is
+	// freed when the thread exits.
+	class ThreadGuard {
+	public:
+		ThreadGuard() = default;
+		ThreadGuard(const ThreadGuard &other) = delete;
+		ThreadGuard &operator=(const ThreadGuard &other) = delete;
+		~ThreadGuard();
+	};
+
+
 public:
 	// Seed the generator (e.g. to make it produce exactly the same random
-	// numbers it produced previously).
+	// numbers it produced previously). Each thread has its own generator.
 	static void Seed(uint64_t seed);
 
 	static uint32_t Int();
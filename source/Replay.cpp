@@ -0,0 +1,338 @@
+/* Replay.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Replay.h"
+
+#include "DataFile.h"
+#include "DataWriter.h"
+#include "Preferences.h"
+
+#include <sstream>
+
+using namespace std;
+
+namespace {
+	string recordPath;
+
+	// The preferences that change what the ships do or how the player's input
+	// is handled, rather than just how the flight is shown.
+	const vector<string> BEHAVIOR_PREFERENCES = {
+		"Clickable radar display",
+		"Control ship with mouse",
+		"Damaged fighters retreat",
+		"Escorts expend ammo",
+		"Escorts use ammo frugally",
+		"Fighters transfer cargo",
+		"Flagship flotsam collection",
+		"Target asteroid based on",
+		"Turrets focus fire"
+	};
+	// The preferences with more than two settings are changed by cycling
+	// through them.
+	class CycledPreference {
+	public:
+		string name;
+		const string &(*setting)();
+		void (*toggle)();
+	};
+	const vector<CycledPreference> CYCLED_PREFERENCES = {
+		{"Automatic aiming", &Preferences::AutoAimSetting, &Preferences::ToggleAutoAim},
+		{"Automatic firing", &Preferences::AutoFireSetting, &Preferences::ToggleAutoFire},
+		{"boarding target", &Preferences::BoardingSetting, &Preferences::ToggleBoarding}
+	};
+	// None of those preferences have more than this many settings.
+	const int MAX_SETTINGS = 4;
+
+	// Checksums and seeds use all 64 bits, which a number token cannot hold
+	// exactly, so they are written as hexadecimal strings instead.
+	string ToHex(uint64_t value)
+	{
+		ostringstream out;
+		out << hex << value;
+		return out.str();
+	}
+
+	uint64_t FromHex(const string &token)
+	{
+		uint64_t value = 0;
+		istringstream(token) >> hex >> value;
+		return value;
+	}
+
+	void WriteRectangle(DataWriter &out, const string &name, const Rectangle &rectangle)
+	{
+		out.Write(name, rectangle.Center().X(), rectangle.Center().Y(),
+			rectangle.Dimensions().X(), rectangle.Dimensions().Y());
+	}
+
+	Rectangle LoadRectangle(const DataNode &node)
+	{
+		return Rectangle(Point(node.Value(1), node.Value(2)), Point(node.Value(3), node.Value(4)));
+	}
+
+	void LoadStep(const DataNode &node, Replay::Step &step)
+	{
+		step.checksum = FromHex(node.Token(1));
+		for(const DataNode &child : node)
+		{
+			const string &key = child.Token(0);
+			if(key == "commands" && child.Size() >= 3)
+				step.commands = Command::FromState(static_cast<uint64_t>(child.Value(1)), child.Value(2));
+			else if(key == "click" && child.Size() >= 3)
+			{
+				step.hasClick = true;
+				step.clickPoint = Point(child.Value(1), child.Value(2));
+				for(const DataNode &grand : child)
+				{
+					if(grand.Token(0) == "right")
+						step.isRightClick = true;
+					else if(grand.Token(0) == "radar")
+						step.isRadarClick = true;
+					else if(grand.Token(0) == "box" && grand.Size() >= 5)
+						step.clickBox = LoadRectangle(grand);
+					else if(grand.Token(0) == "ui box" && grand.Size() >= 5)
+						step.uiClickBox = LoadRectangle(grand);
+					else
+						grand.PrintTrace("Skipping unrecognized attribute:");
+				}
+			}
+			else if(key == "group" && child.Size() >= 2)
+				step.group = child.Value(1);
+			else if(key == "shift")
+				step.hasShift = true;
+			else if(key == "control")
+				step.hasControl = true;
+			else if(key == "mouse" && child.Size() >= 3)
+			{
+				step.isMouseTurning = true;
+				step.mousePosition = Point(child.Value(1), child.Value(2));
+				step.isMouseFiring = child.HasChildren() && child.begin()->Token(0) == "fire";
+			}
+			else
+				child.PrintTrace("Skipping unrecognized attribute:");
+		}
+	}
+
+	void SaveStep(DataWriter &out, const Replay::Step &step)
+	{
+		out.Write("step", ToHex(step.checksum));
+		out.BeginChild();
+		{
+			if(step.commands)
+				out.Write("commands", step.commands.State(), step.commands.Turn());
+			if(step.hasClick)
+			{
+				out.Write("click", step.clickPoint.X(), step.clickPoint.Y());
+				out.BeginChild();
+				{
+					if(step.isRightClick)
+						out.Write("right");
+					if(step.isRadarClick)
+						out.Write("radar");
+					WriteRectangle(out, "box", step.clickBox);
+					WriteRectangle(out, "ui box", step.uiClickBox);
+				}
+				out.EndChild();
+			}
+			if(step.group >= 0)
+				out.Write("group", step.group);
+			if(step.hasShift)
+				out.Write("shift");
+			if(step.hasControl)
+				out.Write("control");
+			if(step.isMouseTurning)
+			{
+				out.Write("mouse", step.mousePosition.X(), step.mousePosition.Y());
+				if(step.isMouseFiring)
+				{
+					out.BeginChild();
+					out.Write("fire");
+					out.EndChild();
+				}
+			}
+		}
+		out.EndChild();
+	}
+}
+
+
+
+void Replay::SetRecordPath(const string &path)
+{
+	recordPath = path;
+}
+
+
+
+const string &Replay::RecordPath()
+{
+	return recordPath;
+}
+
+
+
+// Begin a new recording, starting from the given saved game.
+void Replay::Begin(const string &savePath, uint64_t seed, int firstStep)
+{
+	this->seed = seed;
+	this->firstStep = firstStep;
+	preferences.clear();
+	save.clear();
+	steps.clear();
+
+	for(const string &name : BEHAVIOR_PREFERENCES)
+		preferences[name] = Preferences::Has(name) ? "on" : "off";
+	for(const CycledPreference &preference : CYCLED_PREFERENCES)
+		preferences[preference.name] = preference.setting();
+
+	// Copy the saved game now, in case the player saves over it later.
+	DataFile file(savePath);
+	for(const DataNode &node : file)
+		save.push_back(node);
+}
+
+
+
+bool Replay::Load(const string &path)
+{
+	seed = 0;
+	firstStep = 0;
+	preferences.clear();
+	save.clear();
+	steps.clear();
+
+	DataFile file(path);
+	for(const DataNode &node : file)
+	{
+		if(node.Token(0) != "replay")
+			continue;
+
+		for(const DataNode &child : node)
+		{
+			const string &key = child.Token(0);
+			if(key == "seed" && child.Size() >= 2)
+				seed = FromHex(child.Token(1));
+			else if(key == "first step" && child.Size() >= 2)
+				firstStep = child.Value(1);
+			else if(key == "preferences")
+			{
+				for(const DataNode &grand : child)
+					if(grand.Size() >= 2)
+						preferences[grand.Token(0)] = grand.Token(1);
+					else
+						grand.PrintTrace("Skipping preference with no setting:");
+			}
+			else if(key == "save")
+				for(const DataNode &grand : child)
+					save.push_back(grand);
+			else if(key == "step" && child.Size() >= 2)
+			{
+				steps.emplace_back();
+				LoadStep(child, steps.back());
+			}
+			else
+				child.PrintTrace("Skipping unrecognized attribute:");
+		}
+		return !save.empty() && !steps.empty();
+	}
+	return false;
+}
+
+
+
+void Replay::Save(const string &path) const
+{
+	DataWriter out(path);
+	out.Write("replay");
+	out.BeginChild();
+	{
+		out.Write("seed", ToHex(seed));
+		out.Write("first step", firstStep);
+		out.Write("preferences");
+		out.BeginChild();
+		{
+			for(const auto &it : preferences)
+				out.Write(it.first, it.second);
+		}
+		out.EndChild();
+		out.Write("save");
+		out.BeginChild();
+		{
+			for(const DataNode &node : save)
+				out.Write(node);
+		}
+		out.EndChild();
+		for(const Step &step : steps)
+			SaveStep(out, step);
+	}
+	out.EndChild();
+}
+
+
+
+// Write out the saved game that this recording starts from.
+void Replay::WriteSave(const string &path) const
+{
+	DataWriter out(path);
+	for(const DataNode &node : save)
+		out.Write(node);
+}
+
+
+
+// Change the preferences back to what they were when this was recorded.
+void Replay::ApplyPreferences() const
+{
+	for(const string &name : BEHAVIOR_PREFERENCES)
+	{
+		auto it = preferences.find(name);
+		if(it != preferences.end())
+			Preferences::Set(name, it->second == "on");
+	}
+	for(const CycledPreference &preference : CYCLED_PREFERENCES)
+	{
+		auto it = preferences.find(preference.name);
+		for(int i = 0; it != preferences.end() && preference.setting() != it->second && i < MAX_SETTINGS; ++i)
+			preference.toggle();
+	}
+}
+
+
+
+uint64_t Replay::Seed() const
+{
+	return seed;
+}
+
+
+
+int Replay::FirstStep() const
+{
+	return firstStep;
+}
+
+
+
+vector<Replay::Step> &Replay::Steps()
+{
+	return steps;
+}
+
+
+
+const vector<Replay::Step> &Replay::Steps() const
+{
+	return steps;
+}
@@ -0,0 +1,105 @@
+/* Replay.h
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef REPLAY_H_
+#define REPLAY_H_
+
+#include "Command.h"
+#include "DataNode.h"
+#include "Point.h"
+#include "Rectangle.h"
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+
+
+// A recording of a single flight, from taking off until the engine stops being
+// active (e.g. because the player landed). It stores the saved game the flight
+// started from, the seed used for the random numbers, the preferences that
+// change what the ships do, and all of the player's input to the engine in each
+// step, so that the flight can be played back step by step without a window.
+// A checksum of the game state is recorded for every step, so that playback can
+// tell exactly where it stopped matching.
+class Replay {
+public:
+	// The player's input for one step, and the state of the game before it.
+	class Step {
+	public:
+		// The checksum of the game state at the start of this step.
+		uint64_t checksum = 0;
+
+		// The commands given by the keyboard (or by a test).
+		Command commands;
+
+		// A click that was handled in this step, in the engine's coordinates.
+		bool hasClick = false;
+		bool isRightClick = false;
+		bool isRadarClick = false;
+		Point clickPoint;
+		Rectangle clickBox;
+		Rectangle uiClickBox;
+		// A group of escorts that was selected or assigned in this step.
+		int group = -1;
+		// The modifier keys that were held for the click or group selection.
+		bool hasShift = false;
+		bool hasControl = false;
+
+		// Where the mouse was if the ship was being steered with it.
+		bool isMouseTurning = false;
+		bool isMouseFiring = false;
+		Point mousePosition;
+	};
+
+
+public:
+	// Set where recordings should be saved. If this is empty, nothing is recorded.
+	static void SetRecordPath(const std::string &path);
+	static const std::string &RecordPath();
+
+	// Begin a new recording, starting from the given saved game. The engine's
+	// step counter is recorded too, because animations depend on it, and so are
+	// the preferences that change how the ships behave.
+	void Begin(const std::string &savePath, uint64_t seed, int firstStep);
+	// Load a recording, returning false if the file is not a valid recording.
+	bool Load(const std::string &path);
+	void Save(const std::string &path) const;
+	// Write out the saved game that this recording starts from.
+	void WriteSave(const std::string &path) const;
+	// Change the preferences back to what they were when this was recorded.
+	// This must be done before the engine is created.
+	void ApplyPreferences() const;
+
+	uint64_t Seed() const;
+	int FirstStep() const;
+	std::vector<Step> &Steps();
+	const std::vector<Step> &Steps() const;
+
+
+private:
+	uint64_t seed = 0;
+	int firstStep = 0;
+	// Each recorded preference, and whether it was on or which setting it had.
+	std::map<std::string, std::string> preferences;
+	std::list<DataNode> save;
+	std::vector<Step> steps;
+};
+
+
+
+#endif
@@ -15,12 +15,14 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 
 #include "Ship.h"
 
+#include "AttributeKeys.h"
 #include "Audio.h"
 #include "CategoryList.h"
 #include "CategoryTypes.h"
 #include "DamageDealt.h"
 #include "DataNode.h"
 #include "DataWriter.h"
+#include "Dictionary.h"
 #include "Effect.h"
 #include "Flotsam.h"
 #include "text/Format.h"
@@ -52,6 +54,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include <limits>
 #include <sstream>
 
+using namespace AttributeKeys;
 using namespace std;
 
 namespace {
@@ -787,6 +790,7 @@ void Ship::FinishLoading(bool isNewInstance)
 		warning += "Defaulting " + string(attributes.Get("drag") ? "invalid" : "missing") + " \"drag\" attribute to 100.0\n";
 		attributes.Set("drag", 100.);
 	}
+	stats.Calibrate(attributes);
 
 	// Calculate the values used to determine this ship's value and danger.
 	attraction = CalculateAttraction();
@@ -1287,6 +1291,7 @@ void Ship::Place(Point position, Point velocity, Angle angle, bool isDeparting)
 	hyperspaceCount = 0;
 	forget = 1;
 	targetShip.reset();
+	targetShipHandle = ShipRegistry::Handle();
 	shipToAssist.reset();
 	if(isDeparting)
 		lingerSteps = 0;
@@ -1447,6 +1452,21 @@ ShipAICache &Ship::GetAICache()
 
 
 
+ShipRegistry::Handle Ship::RegistryHandle() const
+{
+	return registeredAs == this ? registryHandle : ShipRegistry::Handle();
+}
+
+
+
+void Ship::SetRegistryHandle(ShipRegistry::Handle handle) const
+{
+	registryHandle = handle;
+	registeredAs = this;
+}
+
+
+
 void Ship::UpdateCaches()
 {
 	aiCache.Recalibrate(*this);
@@ -1731,18 +1751,18 @@ int Ship::Scan(const PlayerInfo &player)
 
 	// The range of a scanner is proportional to the square root of its power.
 	// Because of Pythagoras, if we use square-distance, we can skip this square root.
-	double cargoDistanceSquared = attributes.Get("cargo scan power");
-	double outfitDistanceSquared = attributes.Get("outfit scan power");
+	double cargoDistanceSquared = attributes.Get(CARGO_SCAN_POWER);
+	double outfitDistanceSquared = attributes.Get(OUTFIT_SCAN_POWER);
 
 	// Bail out if this ship has no scanners.
 	if(!cargoDistanceSquared && !outfitDistanceSquared)
 		return 0;
 
-	double cargoSpeed = attributes.Get("cargo scan efficiency");
+	double cargoSpeed = attributes.Get(CARGO_SCAN_EFFICIENCY);
 	if(!cargoSpeed)
 		cargoSpeed = cargoDistanceSquared;
 
-	double outfitSpeed = attributes.Get("outfit scan efficiency");
+	double outfitSpeed = attributes.Get(OUTFIT_SCAN_EFFICIENCY);
 	if(!outfitSpeed)
 		outfitSpeed = outfitDistanceSquared;
 
@@ -1758,7 +1778,7 @@ int Ship::Scan(const PlayerInfo &player)
 	// causing a divide by zero error at sizes of 0.
 	// If instantly scanning very small ships is desirable, this can be removed.
 	double outfits = max(10., target->baseAttributes.Get("outfit space")) * .005;
-	double cargo = max(10., target->attributes.Get("cargo space")) * .005;
+	double cargo = max(10., target->attributes.Get(CARGO_SPACE)) * .005;
 
 	// Check if either scanner has finished scanning.
 	bool startedScanning = false;
@@ -1842,7 +1862,7 @@ int Ship::Scan(const PlayerInfo &player)
 		if(result & ShipEvent::SCAN_OUTFITS)
 			Messages::Add("The " + government->GetName() + " " + Noun() + " \""
 					+ Name() + "\" completed its outfit scan of your ship \"" + target->Name()
-					+ (target->Attributes().Get("inscrutable") > 0. ? "\" with no useful results." : "\"."),
+					+ (target->Attributes().Get(INSCRUTABLE) > 0. ? "\" with no useful results." : "\"."),
 					Messages::Importance::High);
 	}
 
@@ -1937,6 +1957,14 @@ bool Ship::FireAntiMissile(const Projectile &projectile, vector<Visual> &visuals
 
 
 
+// Get the range of the anti-missiles that were found ready to fire.
+double Ship::AntiMissileRange() const
+{
+	return antiMissileRange;
+}
+
+
+
 const System *Ship::GetSystem() const
 {
 	return currentSystem;
@@ -2083,7 +2111,7 @@ bool Ship::IsReadyToJump(bool waitingIsReady) const
 
 	Point direction = targetSystem->Position() - currentSystem->Position();
 	bool isJump = (jumpUsed.first == JumpType::JUMP_DRIVE);
-	double scramThreshold = attributes.Get("scram drive");
+	double scramThreshold = attributes.Get(SCRAM_DRIVE);
 
 	// If the system has a departure distance the ship is only allowed to leave the system
 	// if it is beyond this distance.
@@ -2102,7 +2130,7 @@ bool Ship::IsReadyToJump(bool waitingIsReady) const
 		if(deviation > scramThreshold)
 			return false;
 	}
-	else if(velocity.Length() > attributes.Get("jump speed"))
+	else if(velocity.Length() > attributes.Get(JUMP_SPEED))
 		return false;
 
 	if(!isJump)
@@ -2221,7 +2249,7 @@ void Ship::Restore()
 bool Ship::IsDamaged() const
 {
 	// Account for ships with no shields when determining if they're damaged.
-	return (attributes.Get("shields") != 0 && Shields() != 1.) || Hull() != 1.;
+	return (attributes.Get(SHIELDS) != 0 && Shields() != 1.) || Hull() != 1.;
 }
 
 
@@ -2364,7 +2392,7 @@ void Ship::ClearTargetsAndOrders()
 // Get characteristics of this ship, as a fraction between 0 and 1.
 double Ship::Shields() const
 {
-	double maximum = attributes.Get("shields");
+	double maximum = attributes.Get(SHIELDS);
 	return maximum ? min(1., shields / maximum) : 0.;
 }
 
@@ -2372,7 +2400,7 @@ double Ship::Shields() const
 
 double Ship::Hull() const
 {
-	double maximum = attributes.Get("hull");
+	double maximum = attributes.Get(HULL);
 	return maximum ? min(1., hull / maximum) : 1.;
 }
 
@@ -2380,7 +2408,7 @@ double Ship::Hull() const
 
 double Ship::Fuel() const
 {
-	double maximum = attributes.Get("fuel capacity");
+	double maximum = attributes.Get(FUEL_CAPACITY);
 	return maximum ? min(1., fuel / maximum) : 0.;
 }
 
@@ -2388,7 +2416,7 @@ double Ship::Fuel() const
 
 double Ship::Energy() const
 {
-	double maximum = attributes.Get("energy capacity");
+	double maximum = attributes.Get(ENERGY_CAPACITY);
 	return maximum ? min(1., energy / maximum) : (hull > 0.) ? 1. : 0.;
 }
 
@@ -2408,8 +2436,8 @@ double Ship::Heat() const
 double Ship::Health() const
 {
 	double minimumHull = MinimumHull();
-	double hullDivisor = attributes.Get("hull") - minimumHull;
-	double divisor = attributes.Get("shields") + hullDivisor;
+	double hullDivisor = attributes.Get(HULL) - minimumHull;
+	double divisor = attributes.Get(SHIELDS) + hullDivisor;
 	// This should not happen, but just in case.
 	if(divisor <= 0. || hullDivisor <= 0.)
 		return 0.;
@@ -2424,7 +2452,7 @@ double Ship::Health() const
 // Get the hull fraction at which this ship is disabled.
 double Ship::DisabledHull() const
 {
-	double hull = attributes.Get("hull");
+	double hull = attributes.Get(HULL);
 	double minimumHull = MinimumHull();
 
 	return (hull > 0. ? minimumHull / hull : 0.);
@@ -2501,7 +2529,7 @@ bool Ship::NeedsFuel(bool followParent) const
 	}
 	if(!jumpFuel)
 		jumpFuel = navigation.JumpFuel(targetSystem);
-	return (fuel < jumpFuel) && (attributes.Get("fuel capacity") >= jumpFuel);
+	return (fuel < jumpFuel) && (attributes.Get(FUEL_CAPACITY) >= jumpFuel);
 }
 
 
@@ -2511,7 +2539,7 @@ double Ship::JumpFuelMissing() const
 	// Used for smart refueling: transfer only as much as really needed
 	// includes checking if fuel cap is high enough at all
 	double jumpFuel = navigation.JumpFuel(targetSystem);
-	if(!jumpFuel || fuel > jumpFuel || jumpFuel > attributes.Get("fuel capacity"))
+	if(!jumpFuel || fuel > jumpFuel || jumpFuel > attributes.Get(FUEL_CAPACITY))
 		return 0.;
 
 	return jumpFuel - fuel;
@@ -2523,15 +2551,15 @@ double Ship::JumpFuelMissing() const
 double Ship::IdleHeat() const
 {
 	// This ship's cooling ability:
-	double coolingEfficiency = CoolingEfficiency();
-	double cooling = coolingEfficiency * attributes.Get("cooling");
-	double activeCooling = coolingEfficiency * attributes.Get("active cooling");
+	double coolingEfficiency = stats.coolingEfficiency;
+	double cooling = coolingEfficiency * stats.cooling;
+	double activeCooling = coolingEfficiency * stats.activeCooling;
 
 	// Idle heat is the heat level where:
 	// heat = heat * diss + heatGen - cool - activeCool * heat / (100 * mass)
 	// heat = heat * (diss - activeCool / (100 * mass)) + (heatGen - cool)
 	// heat * (1 - diss + activeCool / (100 * mass)) = (heatGen - cool)
-	double production = max(0., attributes.Get("heat generation") - cooling);
+	double production = max(0., stats.heatGeneration - cooling);
 	double dissipation = HeatDissipation() + activeCooling / MaximumHeat();
 	if(!dissipation) return production ? numeric_limits<double>::max() : 0;
 	return production / dissipation;
@@ -2542,7 +2570,7 @@ double Ship::IdleHeat() const
 // Get the heat dissipation, in heat units per heat unit per frame.
 double Ship::HeatDissipation() const
 {
-	return .001 * attributes.Get("heat dissipation");
+	return stats.heatDissipation;
 }
 
 
@@ -2550,7 +2578,7 @@ double Ship::HeatDissipation() const
 // Get the maximum heat level, in heat units (not temperature).
 double Ship::MaximumHeat() const
 {
-	return MAXIMUM_TEMPERATURE * (cargo.Used() + attributes.Mass() + attributes.Get("heat capacity"));
+	return MAXIMUM_TEMPERATURE * (cargo.Used() + attributes.Mass() + stats.heatCapacity);
 }
 
 
@@ -2558,11 +2586,7 @@ double Ship::MaximumHeat() const
 // Calculate the multiplier for cooling efficiency.
 double Ship::CoolingEfficiency() const
 {
-	// This is an S-curve where the efficiency is 100% if you have no outfits
-	// that create "cooling inefficiency", and as that value increases the
-	// efficiency stays high for a while, then drops off, then approaches 0.
-	double x = attributes.Get("cooling inefficiency");
-	return 2. + 2. / (1. + exp(x / -2.)) - 4. / (1. + exp(x / -4.));
+	return stats.coolingEfficiency;
 }
 
 
@@ -2577,18 +2601,18 @@ int Ship::Crew() const
 // Calculate drag, accounting for drag reduction.
 double Ship::Drag() const
 {
-	return attributes.Get("drag") / (1. + attributes.Get("drag reduction"));
+	return stats.drag;
 }
 
 
 
 int Ship::RequiredCrew() const
 {
-	if(attributes.Get("automaton"))
+	if(attributes.Get(AUTOMATON))
 		return 0;
 
 	// Drones do not need crew, but all other ships need at least one.
-	return max<int>(1, attributes.Get("required crew"));
+	return max<int>(1, attributes.Get(REQUIRED_CREW));
 }
 
 
@@ -2625,22 +2649,21 @@ double Ship::Mass() const
 // Account for inertia reduction, which affects movement but has no effect on the ship's heat capacity.
 double Ship::InertialMass() const
 {
-	return Mass() / (1. + attributes.Get("inertia reduction"));
+	return Mass() / stats.inertiaDivisor;
 }
 
 
 
 double Ship::TurnRate() const
 {
-	return attributes.Get("turn") / InertialMass();
+	return stats.turn / InertialMass();
 }
 
 
 
 double Ship::Acceleration() const
 {
-	double thrust = attributes.Get("thrust");
-	return (thrust ? thrust : attributes.Get("afterburner thrust")) / InertialMass();
+	return (stats.thrust ? stats.thrust : stats.afterburnerThrust) / InertialMass();
 }
 
 
@@ -2650,22 +2673,21 @@ double Ship::MaxVelocity() const
 	// v * drag / mass == thrust / mass
 	// v * drag == thrust
 	// v = thrust / drag
-	double thrust = attributes.Get("thrust");
-	return (thrust ? thrust : attributes.Get("afterburner thrust")) / Drag();
+	return (stats.thrust ? stats.thrust : stats.afterburnerThrust) / Drag();
 }
 
 
 
 double Ship::ReverseAcceleration() const
 {
-	return attributes.Get("reverse thrust");
+	return stats.reverseThrust;
 }
 
 
 
 double Ship::MaxReverseVelocity() const
 {
-	return attributes.Get("reverse thrust") / Drag();
+	return stats.reverseThrust / Drag();
 }
 
 
@@ -2682,13 +2704,13 @@ int Ship::TakeDamage(vector<Visual> &visuals, const DamageDealt &damage, const G
 	shields -= damage.Shield();
 	if(damage.Shield() && !isDisabled)
 	{
-		int disabledDelay = attributes.Get("depleted shield delay");
+		int disabledDelay = attributes.Get(DEPLETED_SHIELD_DELAY);
 		shieldDelay = max<int>(shieldDelay, (shields <= 0. && disabledDelay)
-			? disabledDelay : attributes.Get("shield delay"));
+			? disabledDelay : attributes.Get(SHIELD_DELAY));
 	}
 	hull -= damage.Hull();
 	if(damage.Hull() && !isDisabled)
-		hullDelay = max(hullDelay, static_cast<int>(attributes.Get("repair delay")));
+		hullDelay = max(hullDelay, static_cast<int>(attributes.Get(REPAIR_DELAY)));
 
 	energy -= damage.Energy();
 	heat += damage.Heat();
@@ -2708,8 +2730,8 @@ int Ship::TakeDamage(vector<Visual> &visuals, const DamageDealt &damage, const G
 		ApplyForce(damage.HitForce(), damage.GetWeapon().IsGravitational());
 
 	// Prevent various stats from reaching unallowable values.
-	hull = min(hull, attributes.Get("hull"));
-	shields = min(shields, attributes.Get("shields"));
+	hull = min(hull, attributes.Get(HULL));
+	shields = min(shields, attributes.Get(SHIELDS));
 	// Weapons are allowed to overcharge a ship's energy or fuel, but code in Ship::DoGeneration()
 	// will clamp it to a maximum value at the beginning of the next frame.
 	energy = max(0., energy);
@@ -2725,7 +2747,7 @@ int Ship::TakeDamage(vector<Visual> &visuals, const DamageDealt &damage, const G
 	if(!wasDisabled && isDisabled)
 	{
 		type |= ShipEvent::DISABLE;
-		hullDelay = max(hullDelay, static_cast<int>(attributes.Get("disabled repair delay")));
+		hullDelay = max(hullDelay, static_cast<int>(attributes.Get(DISABLED_REPAIR_DELAY)));
 	}
 	if(!wasDestroyed && IsDestroyed())
 		type |= ShipEvent::DESTROY;
@@ -3064,6 +3086,7 @@ void Ship::AddOutfit(const Outfit *outfit, int count)
 		}
 		int after = outfits.count(outfit);
 		attributes.Add(*outfit, count);
+		stats.Calibrate(attributes);
 		if(outfit->IsWeapon())
 		{
 			armament.Add(outfit, count);
@@ -3125,13 +3148,13 @@ bool Ship::CanFire(const Weapon *weapon) const
 			return false;
 	}
 
-	if(energy < weapon->FiringEnergy() + weapon->RelativeFiringEnergy() * attributes.Get("energy capacity"))
+	if(energy < weapon->FiringEnergy() + weapon->RelativeFiringEnergy() * attributes.Get(ENERGY_CAPACITY))
 		return false;
-	if(fuel < weapon->FiringFuel() + weapon->RelativeFiringFuel() * attributes.Get("fuel capacity"))
+	if(fuel < weapon->FiringFuel() + weapon->RelativeFiringFuel() * attributes.Get(FUEL_CAPACITY))
 		return false;
 	// We do check hull, but we don't check shields. Ships can survive with all shields depleted.
 	// Ships should not disable themselves, so we check if we stay above minimumHull.
-	if(hull - MinimumHull() < weapon->FiringHull() + weapon->RelativeFiringHull() * attributes.Get("hull"))
+	if(hull - MinimumHull() < weapon->FiringHull() + weapon->RelativeFiringHull() * attributes.Get(HULL))
 		return false;
 
 	// If a weapon requires heat to fire, (rather than generating heat), we must
@@ -3159,11 +3182,11 @@ void Ship::ExpendAmmo(const Weapon &weapon)
 {
 	// Compute this ship's initial capacities, in case the consumption of the ammunition outfit(s)
 	// modifies them, so that relative costs are calculated based on the pre-firing state of the ship.
-	const double relativeEnergyChange = weapon.RelativeFiringEnergy() * attributes.Get("energy capacity");
-	const double relativeFuelChange = weapon.RelativeFiringFuel() * attributes.Get("fuel capacity");
+	const double relativeEnergyChange = weapon.RelativeFiringEnergy() * attributes.Get(ENERGY_CAPACITY);
+	const double relativeFuelChange = weapon.RelativeFiringFuel() * attributes.Get(FUEL_CAPACITY);
 	const double relativeHeatChange = !weapon.RelativeFiringHeat() ? 0. : weapon.RelativeFiringHeat() * MaximumHeat();
-	const double relativeHullChange = weapon.RelativeFiringHull() * attributes.Get("hull");
-	const double relativeShieldChange = weapon.RelativeFiringShields() * attributes.Get("shields");
+	const double relativeHullChange = weapon.RelativeFiringHull() * attributes.Get(HULL);
+	const double relativeShieldChange = weapon.RelativeFiringShields() * attributes.Get(SHIELDS);
 
 	if(const Outfit *ammo = weapon.Ammo())
 	{
@@ -3208,6 +3231,13 @@ shared_ptr<Ship> Ship::GetTargetShip() const
 
 
 
+ShipRegistry::Handle Ship::TargetShipHandle() const
+{
+	return targetShipHandle;
+}
+
+
+
 shared_ptr<Ship> Ship::GetShipToAssist() const
 {
 	return shipToAssist.lock();
@@ -3261,6 +3291,8 @@ void Ship::SetTargetShip(const shared_ptr<Ship> &ship)
 		cargoScan = 0.;
 		outfitScan = 0.;
 	}
+	// The target may have been registered since it was last set.
+	targetShipHandle = ship ? ship->RegistryHandle() : ShipRegistry::Handle();
 	targetAsteroid.reset();
 }
 
@@ -3292,6 +3324,7 @@ void Ship::SetTargetAsteroid(const shared_ptr<Minable> &asteroid)
 {
 	targetAsteroid = asteroid;
 	targetShip.reset();
+	targetShipHandle = ShipRegistry::Handle();
 }
 
 
@@ -3513,29 +3546,19 @@ void Ship::DoGeneration()
 		// 4. Shields of carried fighters
 		// 5. Transfer of excess energy and fuel to carried fighters.
 
-		const double hullAvailable = attributes.Get("hull repair rate")
-			* (1. + attributes.Get("hull repair multiplier"));
-		const double hullEnergy = (attributes.Get("hull energy")
-			* (1. + attributes.Get("hull energy multiplier"))) / hullAvailable;
-		const double hullFuel = (attributes.Get("hull fuel")
-			* (1. + attributes.Get("hull fuel multiplier"))) / hullAvailable;
-		const double hullHeat = (attributes.Get("hull heat")
-			* (1. + attributes.Get("hull heat multiplier"))) / hullAvailable;
-		double hullRemaining = hullAvailable;
+		const double hullEnergy = stats.hullEnergy;
+		const double hullFuel = stats.hullFuel;
+		const double hullHeat = stats.hullHeat;
+		double hullRemaining = stats.hullRepair;
 		if(!hullDelay)
-			DoRepair(hull, hullRemaining, attributes.Get("hull"), energy, hullEnergy, fuel, hullFuel, heat, hullHeat);
-
-		const double shieldsAvailable = attributes.Get("shield generation")
-			* (1. + attributes.Get("shield generation multiplier"));
-		const double shieldsEnergy = (attributes.Get("shield energy")
-			* (1. + attributes.Get("shield energy multiplier"))) / shieldsAvailable;
-		const double shieldsFuel = (attributes.Get("shield fuel")
-			* (1. + attributes.Get("shield fuel multiplier"))) / shieldsAvailable;
-		const double shieldsHeat = (attributes.Get("shield heat")
-			* (1. + attributes.Get("shield heat multiplier"))) / shieldsAvailable;
-		double shieldsRemaining = shieldsAvailable;
+			DoRepair(hull, hullRemaining, attributes.Get(HULL), energy, hullEnergy, fuel, hullFuel, heat, hullHeat);
+
+		const double shieldsEnergy = stats.shieldEnergy;
+		const double shieldsFuel = stats.shieldFuel;
+		const double shieldsHeat = stats.shieldHeat;
+		double shieldsRemaining = stats.shieldGeneration;
 		if(!shieldDelay)
-			DoRepair(shields, shieldsRemaining, attributes.Get("shields"),
+			DoRepair(shields, shieldsRemaining, attributes.Get(SHIELDS),
 				energy, shieldsEnergy, fuel, shieldsFuel, heat, shieldsHeat);
 
 		if(!bays.empty())
@@ -3560,24 +3583,24 @@ void Ship::DoGeneration()
 			{
 				Ship &ship = *it.second;
 				if(!hullDelay)
-					DoRepair(ship.hull, hullRemaining, ship.attributes.Get("hull"),
+					DoRepair(ship.hull, hullRemaining, ship.attributes.Get(HULL),
 						energy, hullEnergy, heat, hullHeat, fuel, hullFuel);
 				if(!shieldDelay)
-					DoRepair(ship.shields, shieldsRemaining, ship.attributes.Get("shields"),
+					DoRepair(ship.shields, shieldsRemaining, ship.attributes.Get(SHIELDS),
 						energy, shieldsEnergy, heat, shieldsHeat, fuel, shieldsFuel);
 			}
 
 			// Now that there is no more need to use energy for hull and shield
 			// repair, if there is still excess energy, transfer it.
-			double energyRemaining = energy - attributes.Get("energy capacity");
-			double fuelRemaining = fuel - attributes.Get("fuel capacity");
+			double energyRemaining = energy - attributes.Get(ENERGY_CAPACITY);
+			double fuelRemaining = fuel - attributes.Get(FUEL_CAPACITY);
 			for(const pair<double, Ship *> &it : carried)
 			{
 				Ship &ship = *it.second;
 				if(energyRemaining > 0.)
-					DoRepair(ship.energy, energyRemaining, ship.attributes.Get("energy capacity"));
+					DoRepair(ship.energy, energyRemaining, ship.attributes.Get(ENERGY_CAPACITY));
 				if(fuelRemaining > 0.)
-					DoRepair(ship.fuel, fuelRemaining, ship.attributes.Get("fuel capacity"));
+					DoRepair(ship.fuel, fuelRemaining, ship.attributes.Get(FUEL_CAPACITY));
 			}
 
 			// Carried ships can recharge energy from their parent's batteries,
@@ -3587,9 +3610,9 @@ void Ship::DoGeneration()
 			{
 				Ship &ship = *it.second;
 				if(ship.HasDeployOrder())
-					DoRepair(ship.energy, energy, ship.attributes.Get("energy capacity"));
+					DoRepair(ship.energy, energy, ship.attributes.Get(ENERGY_CAPACITY));
 				else
-					DoRepair(energy, ship.energy, attributes.Get("energy capacity"));
+					DoRepair(energy, ship.energy, attributes.Get(ENERGY_CAPACITY));
 			}
 		}
 		// Decrease the shield and hull delays by 1 now that shield generation
@@ -3607,80 +3630,80 @@ void Ship::DoGeneration()
 	// TODO: Mothership gives status resistance to carried ships?
 	if(ionization)
 	{
-		double ionResistance = attributes.Get("ion resistance");
-		double ionEnergy = attributes.Get("ion resistance energy") / ionResistance;
-		double ionFuel = attributes.Get("ion resistance fuel") / ionResistance;
-		double ionHeat = attributes.Get("ion resistance heat") / ionResistance;
+		double ionResistance = attributes.Get(ION_RESISTANCE);
+		double ionEnergy = attributes.Get(ION_RESISTANCE_ENERGY) / ionResistance;
+		double ionFuel = attributes.Get(ION_RESISTANCE_FUEL) / ionResistance;
+		double ionHeat = attributes.Get(ION_RESISTANCE_HEAT) / ionResistance;
 		DoStatusEffect(isDisabled, ionization, ionResistance,
 			energy, ionEnergy, fuel, ionFuel, heat, ionHeat);
 	}
 
 	if(scrambling)
 	{
-		double scramblingResistance = attributes.Get("scramble resistance");
-		double scramblingEnergy = attributes.Get("scramble resistance energy") / scramblingResistance;
-		double scramblingFuel = attributes.Get("scramble resistance fuel") / scramblingResistance;
-		double scramblingHeat = attributes.Get("scramble resistance heat") / scramblingResistance;
+		double scramblingResistance = attributes.Get(SCRAMBLE_RESISTANCE);
+		double scramblingEnergy = attributes.Get(SCRAMBLE_RESISTANCE_ENERGY) / scramblingResistance;
+		double scramblingFuel = attributes.Get(SCRAMBLE_RESISTANCE_FUEL) / scramblingResistance;
+		double scramblingHeat = attributes.Get(SCRAMBLE_RESISTANCE_HEAT) / scramblingResistance;
 		DoStatusEffect(isDisabled, scrambling, scramblingResistance,
 			energy, scramblingEnergy, fuel, scramblingFuel, heat, scramblingHeat);
 	}
 
 	if(disruption)
 	{
-		double disruptionResistance = attributes.Get("disruption resistance");
-		double disruptionEnergy = attributes.Get("disruption resistance energy") / disruptionResistance;
-		double disruptionFuel = attributes.Get("disruption resistance fuel") / disruptionResistance;
-		double disruptionHeat = attributes.Get("disruption resistance heat") / disruptionResistance;
+		double disruptionResistance = attributes.Get(DISRUPTION_RESISTANCE);
+		double disruptionEnergy = attributes.Get(DISRUPTION_RESISTANCE_ENERGY) / disruptionResistance;
+		double disruptionFuel = attributes.Get(DISRUPTION_RESISTANCE_FUEL) / disruptionResistance;
+		double disruptionHeat = attributes.Get(DISRUPTION_RESISTANCE_HEAT) / disruptionResistance;
 		DoStatusEffect(isDisabled, disruption, disruptionResistance,
 			energy, disruptionEnergy, fuel, disruptionFuel, heat, disruptionHeat);
 	}
 
 	if(slowness)
 	{
-		double slowingResistance = attributes.Get("slowing resistance");
-		double slowingEnergy = attributes.Get("slowing resistance energy") / slowingResistance;
-		double slowingFuel = attributes.Get("slowing resistance fuel") / slowingResistance;
-		double slowingHeat = attributes.Get("slowing resistance heat") / slowingResistance;
+		double slowingResistance = attributes.Get(SLOWING_RESISTANCE);
+		double slowingEnergy = attributes.Get(SLOWING_RESISTANCE_ENERGY) / slowingResistance;
+		double slowingFuel = attributes.Get(SLOWING_RESISTANCE_FUEL) / slowingResistance;
+		double slowingHeat = attributes.Get(SLOWING_RESISTANCE_HEAT) / slowingResistance;
 		DoStatusEffect(isDisabled, slowness, slowingResistance,
 			energy, slowingEnergy, fuel, slowingFuel, heat, slowingHeat);
 	}
 
 	if(discharge)
 	{
-		double dischargeResistance = attributes.Get("discharge resistance");
-		double dischargeEnergy = attributes.Get("discharge resistance energy") / dischargeResistance;
-		double dischargeFuel = attributes.Get("discharge resistance fuel") / dischargeResistance;
-		double dischargeHeat = attributes.Get("discharge resistance heat") / dischargeResistance;
+		double dischargeResistance = attributes.Get(DISCHARGE_RESISTANCE);
+		double dischargeEnergy = attributes.Get(DISCHARGE_RESISTANCE_ENERGY) / dischargeResistance;
+		double dischargeFuel = attributes.Get(DISCHARGE_RESISTANCE_FUEL) / dischargeResistance;
+		double dischargeHeat = attributes.Get(DISCHARGE_RESISTANCE_HEAT) / dischargeResistance;
 		DoStatusEffect(isDisabled, discharge, dischargeResistance,
 			energy, dischargeEnergy, fuel, dischargeFuel, heat, dischargeHeat);
 	}
 
 	if(corrosion)
 	{
-		double corrosionResistance = attributes.Get("corrosion resistance");
-		double corrosionEnergy = attributes.Get("corrosion resistance energy") / corrosionResistance;
-		double corrosionFuel = attributes.Get("corrosion resistance fuel") / corrosionResistance;
-		double corrosionHeat = attributes.Get("corrosion resistance heat") / corrosionResistance;
+		double corrosionResistance = attributes.Get(CORROSION_RESISTANCE);
+		double corrosionEnergy = attributes.Get(CORROSION_RESISTANCE_ENERGY) / corrosionResistance;
+		double corrosionFuel = attributes.Get(CORROSION_RESISTANCE_FUEL) / corrosionResistance;
+		double corrosionHeat = attributes.Get(CORROSION_RESISTANCE_HEAT) / corrosionResistance;
 		DoStatusEffect(isDisabled, corrosion, corrosionResistance,
 			energy, corrosionEnergy, fuel, corrosionFuel, heat, corrosionHeat);
 	}
 
 	if(leakage)
 	{
-		double leakResistance = attributes.Get("leak resistance");
-		double leakEnergy = attributes.Get("leak resistance energy") / leakResistance;
-		double leakFuel = attributes.Get("leak resistance fuel") / leakResistance;
-		double leakHeat = attributes.Get("leak resistance heat") / leakResistance;
+		double leakResistance = attributes.Get(LEAK_RESISTANCE);
+		double leakEnergy = attributes.Get(LEAK_RESISTANCE_ENERGY) / leakResistance;
+		double leakFuel = attributes.Get(LEAK_RESISTANCE_FUEL) / leakResistance;
+		double leakHeat = attributes.Get(LEAK_RESISTANCE_HEAT) / leakResistance;
 		DoStatusEffect(isDisabled, leakage, leakResistance,
 			energy, leakEnergy, fuel, leakFuel, heat, leakHeat);
 	}
 
 	if(burning)
 	{
-		double burnResistance = attributes.Get("burn resistance");
-		double burnEnergy = attributes.Get("burn resistance energy") / burnResistance;
-		double burnFuel = attributes.Get("burn resistance fuel") / burnResistance;
-		double burnHeat = attributes.Get("burn resistance heat") / burnResistance;
+		double burnResistance = attributes.Get(BURN_RESISTANCE);
+		double burnEnergy = attributes.Get(BURN_RESISTANCE_ENERGY) / burnResistance;
+		double burnFuel = attributes.Get(BURN_RESISTANCE_FUEL) / burnResistance;
+		double burnHeat = attributes.Get(BURN_RESISTANCE_HEAT) / burnResistance;
 		DoStatusEffect(isDisabled, burning, burnResistance,
 			energy, burnEnergy, fuel, burnFuel, heat, burnHeat);
 	}
@@ -3689,23 +3712,23 @@ void Ship::DoGeneration()
 	// maximum capacity for the rest of the turn, but must be clamped to the
 	// maximum here before they gain more. This is so that, for example, a ship
 	// with no batteries but a good generator can still move.
-	energy = min(energy, attributes.Get("energy capacity"));
-	fuel = min(fuel, attributes.Get("fuel capacity"));
+	energy = min(energy, attributes.Get(ENERGY_CAPACITY));
+	fuel = min(fuel, attributes.Get(FUEL_CAPACITY));
 
 	heat -= heat * HeatDissipation();
 	if(heat > MaximumHeat())
 	{
 		isOverheated = true;
-		double heatRatio = Heat() / (1. + attributes.Get("overheat damage threshold"));
+		double heatRatio = Heat() / (1. + attributes.Get(OVERHEAT_DAMAGE_THRESHOLD));
 		if(heatRatio > 1.)
-			hull -= attributes.Get("overheat damage rate") * heatRatio;
+			hull -= attributes.Get(OVERHEAT_DAMAGE_RATE) * heatRatio;
 	}
 	else if(heat < .9 * MaximumHeat())
 		isOverheated = false;
 
-	double maxShields = attributes.Get("shields");
+	double maxShields = attributes.Get(SHIELDS);
 	shields = min(shields, maxShields);
-	double maxHull = attributes.Get("hull");
+	double maxHull = attributes.Get(HULL);
 	hull = min(hull, maxHull);
 
 	isDisabled = isOverheated || hull < MinimumHull() || (!crew && RequiredCrew());
@@ -3720,35 +3743,35 @@ void Ship::DoGeneration()
 		if(currentSystem)
 		{
 			double scale = .2 + 1.8 / (.001 * position.Length() + 1);
-			fuel += currentSystem->RamscoopFuel(attributes.Get("ramscoop"), scale);
+			fuel += currentSystem->RamscoopFuel(stats.ramscoop, scale);
 
 			double solarScaling = currentSystem->SolarPower() * scale;
-			energy += solarScaling * attributes.Get("solar collection");
-			heat += solarScaling * attributes.Get("solar heat");
+			energy += solarScaling * stats.solarCollection;
+			heat += solarScaling * stats.solarHeat;
 		}
 
-		double coolingEfficiency = CoolingEfficiency();
-		energy += attributes.Get("energy generation") - attributes.Get("energy consumption");
-		fuel += attributes.Get("fuel generation");
-		heat += attributes.Get("heat generation");
-		heat -= coolingEfficiency * attributes.Get("cooling");
+		double coolingEfficiency = stats.coolingEfficiency;
+		energy += stats.netEnergyGeneration;
+		fuel += stats.fuelGeneration;
+		heat += stats.heatGeneration;
+		heat -= coolingEfficiency * stats.cooling;
 
 		// Convert fuel into energy and heat only when the required amount of fuel is available.
-		if(attributes.Get("fuel consumption") <= fuel)
+		if(stats.fuelConsumption <= fuel)
 		{
-			fuel -= attributes.Get("fuel consumption");
-			energy += attributes.Get("fuel energy");
-			heat += attributes.Get("fuel heat");
+			fuel -= stats.fuelConsumption;
+			energy += stats.fuelEnergy;
+			heat += stats.fuelHeat;
 		}
 
 		// Apply active cooling. The fraction of full cooling to apply equals
 		// your ship's current fraction of its maximum temperature.
-		double activeCooling = coolingEfficiency * attributes.Get("active cooling");
+		double activeCooling = coolingEfficiency * stats.activeCooling;
 		if(activeCooling > 0. && heat > 0. && energy >= 0.)
 		{
 			// Handle the case where "active cooling"
 			// does not require any energy.
-			double coolingEnergy = attributes.Get("cooling energy");
+			double coolingEnergy = stats.coolingEnergy;
 			if(coolingEnergy)
 			{
 				double spentEnergy = min(energy, coolingEnergy * min(1., Heat()));
@@ -3817,17 +3840,17 @@ void Ship::DoCloakDecision()
 	if(!cloak)
 		cloakDisruption = max(0., cloakDisruption - 1.);
 
-	double cloakingSpeed = attributes.Get("cloak");
+	double cloakingSpeed = attributes.Get(CLOAK);
 	bool canCloak = (!isDisabled && cloakingSpeed > 0. && !cloakDisruption
-		&& fuel >= attributes.Get("cloaking fuel")
-		&& energy >= attributes.Get("cloaking energy"));
+		&& fuel >= attributes.Get(CLOAKING_FUEL)
+		&& energy >= attributes.Get(CLOAKING_ENERGY));
 
 	if(commands.Has(Command::CLOAK) && canCloak)
 	{
 		cloak = min(1., cloak + cloakingSpeed);
-		fuel -= attributes.Get("cloaking fuel");
-		energy -= attributes.Get("cloaking energy");
-		heat += attributes.Get("cloaking heat");
+		fuel -= attributes.Get(CLOAKING_FUEL);
+		energy -= attributes.Get(CLOAKING_ENERGY);
+		heat += attributes.Get(CLOAKING_HEAT);
 	}
 	else if(cloakingSpeed)
 	{
@@ -4000,7 +4023,7 @@ bool Ship::DoLandingLogic()
 	if(isDisabled)
 		landingPlanet = nullptr;
 
-	float landingSpeed = attributes.Get("landing speed");
+	float landingSpeed = attributes.Get(LANDING_SPEED);
 	landingSpeed = landingSpeed > 0 ? landingSpeed : .02f;
 	// Special ships do not disappear forever when they land; they
 	// just slowly refuel.
@@ -4035,7 +4058,7 @@ bool Ship::DoLandingLogic()
 		}
 	}
 	// Only refuel if this planet has a spaceport.
-	else if(fuel >= attributes.Get("fuel capacity")
+	else if(fuel >= attributes.Get(FUEL_CAPACITY)
 			|| !landingPlanet || !landingPlanet->HasSpaceport())
 	{
 		zoom = min(1.f, zoom + landingSpeed);
@@ -4043,7 +4066,7 @@ bool Ship::DoLandingLogic()
 		landingPlanet = nullptr;
 	}
 	else
-		fuel = min(fuel + 1., attributes.Get("fuel capacity"));
+		fuel = min(fuel + 1., attributes.Get(FUEL_CAPACITY));
 
 	// Move the ship at the velocity it had when it began landing, but
 	// scaled based on how small it is now.
@@ -4121,23 +4144,23 @@ void Ship::DoMovement(bool &isUsingAfterburner)
 		if(commands.Turn())
 		{
 			// Check if we are able to turn.
-			double cost = attributes.Get("turning energy");
+			double cost = attributes.Get(TURNING_ENERGY);
 			if(cost > 0. && energy < cost * fabs(commands.Turn()))
 				commands.SetTurn(commands.Turn() * energy / (cost * fabs(commands.Turn())));
 
-			cost = attributes.Get("turning shields");
+			cost = attributes.Get(TURNING_SHIELDS);
 			if(cost > 0. && shields < cost * fabs(commands.Turn()))
 				commands.SetTurn(commands.Turn() * shields / (cost * fabs(commands.Turn())));
 
-			cost = attributes.Get("turning hull");
+			cost = attributes.Get(TURNING_HULL);
 			if(cost > 0. && hull < cost * fabs(commands.Turn()))
 				commands.SetTurn(commands.Turn() * hull / (cost * fabs(commands.Turn())));
 
-			cost = attributes.Get("turning fuel");
+			cost = attributes.Get(TURNING_FUEL);
 			if(cost > 0. && fuel < cost * fabs(commands.Turn()))
 				commands.SetTurn(commands.Turn() * fuel / (cost * fabs(commands.Turn())));
 
-			cost = -attributes.Get("turning heat");
+			cost = -attributes.Get(TURNING_HEAT);
 			if(cost > 0. && heat < cost * fabs(commands.Turn()))
 				commands.SetTurn(commands.Turn() * heat / (cost * fabs(commands.Turn())));
 
@@ -4150,19 +4173,19 @@ void Ship::DoMovement(bool &isUsingAfterburner)
 				// of the turning energy and produce a fraction of the heat.
 				double scale = fabs(commands.Turn());
 
-				shields -= scale * attributes.Get("turning shields");
-				hull -= scale * attributes.Get("turning hull");
-				energy -= scale * attributes.Get("turning energy");
-				fuel -= scale * attributes.Get("turning fuel");
-				heat += scale * attributes.Get("turning heat");
-				discharge += scale * attributes.Get("turning discharge");
-				corrosion += scale * attributes.Get("turning corrosion");
-				ionization += scale * attributes.Get("turning ion");
-				scrambling += scale * attributes.Get("turning scramble");
-				leakage += scale * attributes.Get("turning leakage");
-				burning += scale * attributes.Get("turning burn");
-				slowness += scale * attributes.Get("turning slowing");
-				disruption += scale * attributes.Get("turning disruption");
+				shields -= scale * attributes.Get(TURNING_SHIELDS);
+				hull -= scale * attributes.Get(TURNING_HULL);
+				energy -= scale * attributes.Get(TURNING_ENERGY);
+				fuel -= scale * attributes.Get(TURNING_FUEL);
+				heat += scale * attributes.Get(TURNING_HEAT);
+				discharge += scale * attributes.Get(TURNING_DISCHARGE);
+				corrosion += scale * attributes.Get(TURNING_CORROSION);
+				ionization += scale * attributes.Get(TURNING_ION);
+				scrambling += scale * attributes.Get(TURNING_SCRAMBLE);
+				leakage += scale * attributes.Get(TURNING_LEAKAGE);
+				burning += scale * attributes.Get(TURNING_BURN);
+				slowness += scale * attributes.Get(TURNING_SLOWING);
+				disruption += scale * attributes.Get(TURNING_DISRUPTION);
 
 				angle += commands.Turn() * TurnRate() * slowMultiplier;
 			}
@@ -4172,28 +4195,23 @@ void Ship::DoMovement(bool &isUsingAfterburner)
 		if(thrustCommand)
 		{
 			// Check if we are able to apply this thrust.
-			double cost = attributes.Get((thrustCommand > 0.) ?
-				"thrusting energy" : "reverse thrusting energy");
+			double cost = attributes.Get((thrustCommand > 0.) ? THRUSTING_ENERGY : REVERSE_THRUSTING_ENERGY);
 			if(cost > 0. && energy < cost)
 				thrustCommand *= energy / cost;
 
-			cost = attributes.Get((thrustCommand > 0.) ?
-				"thrusting shields" : "reverse thrusting shields");
+			cost = attributes.Get((thrustCommand > 0.) ? THRUSTING_SHIELDS : REVERSE_THRUSTING_SHIELDS);
 			if(cost > 0. && shields < cost)
 				thrustCommand *= shields / cost;
 
-			cost = attributes.Get((thrustCommand > 0.) ?
-				"thrusting hull" : "reverse thrusting hull");
+			cost = attributes.Get((thrustCommand > 0.) ? THRUSTING_HULL : REVERSE_THRUSTING_HULL);
 			if(cost > 0. && hull < cost)
 				thrustCommand *= hull / cost;
 
-			cost = attributes.Get((thrustCommand > 0.) ?
-				"thrusting fuel" : "reverse thrusting fuel");
+			cost = attributes.Get((thrustCommand > 0.) ? THRUSTING_FUEL : REVERSE_THRUSTING_FUEL);
 			if(cost > 0. && fuel < cost)
 				thrustCommand *= fuel / cost;
 
-			cost = -attributes.Get((thrustCommand > 0.) ?
-				"thrusting heat" : "reverse thrusting heat");
+			cost = -attributes.Get((thrustCommand > 0.) ? THRUSTING_HEAT : REVERSE_THRUSTING_HEAT);
 			if(cost > 0. && heat < cost)
 				thrustCommand *= heat / cost;
 
@@ -4202,26 +4220,25 @@ void Ship::DoMovement(bool &isUsingAfterburner)
 				// If a reverse thrust is commanded and the capability does not
 				// exist, ignore it (do not even slow under drag).
 				isThrusting = (thrustCommand > 0.);
-				isReversing = !isThrusting && attributes.Get("reverse thrust");
-				thrust = attributes.Get(isThrusting ? "thrust" : "reverse thrust");
+				isReversing = !isThrusting && stats.reverseThrust;
+				thrust = isThrusting ? stats.thrust : stats.reverseThrust;
 				if(thrust)
 				{
 					double scale = fabs(thrustCommand);
 
-					shields -= scale * attributes.Get(isThrusting ? "thrusting shields" : "reverse thrusting shields");
-					hull -= scale * attributes.Get(isThrusting ? "thrusting hull" : "reverse thrusting hull");
-					energy -= scale * attributes.Get(isThrusting ? "thrusting energy" : "reverse thrusting energy");
-					fuel -= scale * attributes.Get(isThrusting ? "thrusting fuel" : "reverse thrusting fuel");
-					heat += scale * attributes.Get(isThrusting ? "thrusting heat" : "reverse thrusting heat");
-					discharge += scale * attributes.Get(isThrusting ? "thrusting discharge" : "reverse thrusting discharge");
-					corrosion += scale * attributes.Get(isThrusting ? "thrusting corrosion" : "reverse thrusting corrosion");
-					ionization += scale * attributes.Get(isThrusting ? "thrusting ion" : "reverse thrusting ion");
-					scrambling += scale * attributes.Get(isThrusting ? "thrusting scramble" :
-						"reverse thrusting scramble");
-					burning += scale * attributes.Get(isThrusting ? "thrusting burn" : "reverse thrusting burn");
-					leakage += scale * attributes.Get(isThrusting ? "thrusting leakage" : "reverse thrusting leakage");
-					slowness += scale * attributes.Get(isThrusting ? "thrusting slowing" : "reverse thrusting slowing");
-					disruption += scale * attributes.Get(isThrusting ? "thrusting disruption" : "reverse thrusting disruption");
+					shields -= scale * attributes.Get(isThrusting ? THRUSTING_SHIELDS : REVERSE_THRUSTING_SHIELDS);
+					hull -= scale * attributes.Get(isThrusting ? THRUSTING_HULL : REVERSE_THRUSTING_HULL);
+					energy -= scale * attributes.Get(isThrusting ? THRUSTING_ENERGY : REVERSE_THRUSTING_ENERGY);
+					fuel -= scale * attributes.Get(isThrusting ? THRUSTING_FUEL : REVERSE_THRUSTING_FUEL);
+					heat += scale * attributes.Get(isThrusting ? THRUSTING_HEAT : REVERSE_THRUSTING_HEAT);
+					discharge += scale * attributes.Get(isThrusting ? THRUSTING_DISCHARGE : REVERSE_THRUSTING_DISCHARGE);
+					corrosion += scale * attributes.Get(isThrusting ? THRUSTING_CORROSION : REVERSE_THRUSTING_CORROSION);
+					ionization += scale * attributes.Get(isThrusting ? THRUSTING_ION : REVERSE_THRUSTING_ION);
+					scrambling += scale * attributes.Get(isThrusting ? THRUSTING_SCRAMBLE : REVERSE_THRUSTING_SCRAMBLE);
+					burning += scale * attributes.Get(isThrusting ? THRUSTING_BURN : REVERSE_THRUSTING_BURN);
+					leakage += scale * attributes.Get(isThrusting ? THRUSTING_LEAKAGE : REVERSE_THRUSTING_LEAKAGE);
+					slowness += scale * attributes.Get(isThrusting ? THRUSTING_SLOWING : REVERSE_THRUSTING_SLOWING);
+					disruption += scale * attributes.Get(isThrusting ? THRUSTING_DISRUPTION : REVERSE_THRUSTING_DISRUPTION);
 
 					acceleration += angle.Unit() * (thrustCommand * thrust / mass);
 				}
@@ -4231,22 +4248,22 @@ void Ship::DoMovement(bool &isUsingAfterburner)
 				&& !CannotAct();
 		if(applyAfterburner)
 		{
-			thrust = attributes.Get("afterburner thrust");
-			double shieldCost = attributes.Get("afterburner shields");
-			double hullCost = attributes.Get("afterburner hull");
-			double energyCost = attributes.Get("afterburner energy");
-			double fuelCost = attributes.Get("afterburner fuel");
-			double heatCost = -attributes.Get("afterburner heat");
-
-			double dischargeCost = attributes.Get("afterburner discharge");
-			double corrosionCost = attributes.Get("afterburner corrosion");
-			double ionCost = attributes.Get("afterburner ion");
-			double scramblingCost = attributes.Get("afterburner scramble");
-			double leakageCost = attributes.Get("afterburner leakage");
-			double burningCost = attributes.Get("afterburner burn");
-
-			double slownessCost = attributes.Get("afterburner slowing");
-			double disruptionCost = attributes.Get("afterburner disruption");
+			thrust = stats.afterburnerThrust;
+			double shieldCost = attributes.Get(AFTERBURNER_SHIELDS);
+			double hullCost = attributes.Get(AFTERBURNER_HULL);
+			double energyCost = attributes.Get(AFTERBURNER_ENERGY);
+			double fuelCost = attributes.Get(AFTERBURNER_FUEL);
+			double heatCost = -attributes.Get(AFTERBURNER_HEAT);
+
+			double dischargeCost = attributes.Get(AFTERBURNER_DISCHARGE);
+			double corrosionCost = attributes.Get(AFTERBURNER_CORROSION);
+			double ionCost = attributes.Get(AFTERBURNER_ION);
+			double scramblingCost = attributes.Get(AFTERBURNER_SCRAMBLE);
+			double leakageCost = attributes.Get(AFTERBURNER_LEAKAGE);
+			double burningCost = attributes.Get(AFTERBURNER_BURN);
+
+			double slownessCost = attributes.Get(AFTERBURNER_SLOWING);
+			double disruptionCost = attributes.Get(AFTERBURNER_DISRUPTION);
 
 			if(thrust && shields >= shieldCost && hull >= hullCost
 				&& energy >= energyCost && fuel >= fuelCost && heat >= heatCost)
@@ -4363,7 +4380,7 @@ void Ship::StepTargeting()
 				{
 					isBoarding = false;
 					bool isEnemy = government->IsEnemy(target->government);
-					if(isEnemy && Random::Real() < target->Attributes().Get("self destruct"))
+					if(isEnemy && Random::Real() < target->Attributes().Get(SELF_DESTRUCT))
 					{
 						Messages::Add("The " + target->ModelName() + " \"" + target->Name()
 							+ "\" has activated its self-destruct mechanism.", Messages::Importance::High);
@@ -4380,7 +4397,10 @@ void Ship::StepTargeting()
 	// because ordinary ships cease to exist once they are destroyed.
 	target = GetTargetShip();
 	if(target && target->IsDestroyed() && target->explosionCount >= target->explosionTotal)
+	{
 		targetShip.reset();
+		targetShipHandle = ShipRegistry::Handle();
+	}
 }
 
 
@@ -4429,17 +4449,17 @@ double Ship::MinimumHull() const
 	if(neverDisabled)
 		return 0.;
 
-	double maximumHull = attributes.Get("hull");
-	double absoluteThreshold = attributes.Get("absolute threshold");
+	double maximumHull = attributes.Get(HULL);
+	double absoluteThreshold = attributes.Get(ABSOLUTE_THRESHOLD);
 	if(absoluteThreshold > 0.)
 		return absoluteThreshold;
 
-	double thresholdPercent = attributes.Get("threshold percentage");
+	double thresholdPercent = attributes.Get(THRESHOLD_PERCENTAGE);
 	double transition = 1 / (1 + 0.0005 * maximumHull);
 	double minimumHull = maximumHull * (thresholdPercent > 0.
 		? min(thresholdPercent, 1.) : 0.1 * (1. - transition) + 0.5 * transition);
 
-	return max(0., floor(minimumHull + attributes.Get("hull threshold")));
+	return max(0., floor(minimumHull + attributes.Get(HULL_THRESHOLD)));
 }
 
 
@@ -28,7 +28,9 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "Personality.h"
 #include "Point.h"
 #include "ship/ShipAICache.h"
+#include "ship/ShipDerivedStats.h"
 #include "ShipJumpNavigation.h"
+#include "ShipRegistry.h"
 
 #include <list>
 #include <map>
@@ -202,6 +204,10 @@ public:
 	// Access the ship's AI cache, containing the range and expected AI behavior for this ship.
 	ShipAICache &GetAICache();
 	void UpdateCaches();
+	// This ship's handle in the registry of ships being simulated. A copy of a
+	// registered ship does not share its handle.
+	ShipRegistry::Handle RegistryHandle() const;
+	void SetRegistryHandle(ShipRegistry::Handle handle) const;
 
 	// Set the commands for this ship to follow this timestep.
 	void SetCommands(const Command &command);
@@ -231,6 +237,8 @@ public:
 	bool Fire(std::vector<Projectile> &projectiles, std::vector<Visual> &visuals);
 	// Fire an anti-missile. Returns true if the missile was killed.
 	bool FireAntiMissile(const Projectile &projectile, std::vector<Visual> &visuals);
+	// Get the range of the anti-missiles that were found ready by Fire().
+	double AntiMissileRange() const;
 
 	// Get the system this ship is in. Set to nullptr if the ship is being carried.
 	const System *GetSystem() const;
@@ -423,6 +431,8 @@ public:
 	// Each ship can have a target system (to travel to), a target planet (to
 	// land on) and a target ship (to move to, and attack if hostile).
 	std::shared_ptr<Ship> GetTargetShip() const;
+	// The target ship's registry handle, if it had one when it was targeted.
+	ShipRegistry::Handle TargetShipHandle() const;
 	std::shared_ptr<Ship> GetShipToAssist() const;
 	const StellarObject *GetTargetStellar() const;
 	// Get ship's target system (it should always be one jump / wormhole pass away).
@@ -568,9 +578,13 @@ private:
 	Personality personality;
 	const Phrase *hail = nullptr;
 	ShipAICache aiCache;
+	mutable ShipRegistry::Handle registryHandle;
+	mutable const Ship *registeredAs = nullptr;
 
 	// Installed outfits, cargo, etc.:
 	Outfit attributes;
+	// Values derived from the attributes that are needed every step.
+	ShipDerivedStats stats;
 	Outfit baseAttributes;
 	bool addAttributes = false;
 	const Outfit *explosionWeapon = nullptr;
@@ -656,6 +670,7 @@ private:
 
 	// Target ships, planets, systems, etc.
 	std::weak_ptr<Ship> targetShip;
+	ShipRegistry::Handle targetShipHandle;
 	std::weak_ptr<Ship> shipToAssist;
 	const StellarObject *targetPlanet = nullptr;
 	const System *targetSystem = nullptr;
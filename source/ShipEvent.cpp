@@ -17,26 +17,28 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 
 #include "Ship.h"
 
+#include <utility>
+
 using namespace std;
 
 
 
-ShipEvent::ShipEvent(const Government *actor, const shared_ptr<Ship> &target, int type)
-	: actorGovernment(actor), target(target), type(type)
+ShipEvent::ShipEvent(const Government *actor, shared_ptr<Ship> target, int type)
+	: actorGovernment(actor), target(std::move(target)), type(type)
 {
-	if(target)
-		targetGovernment = target->GetGovernment();
+	if(this->target)
+		targetGovernment = this->target->GetGovernment();
 }
 
 
 
-ShipEvent::ShipEvent(const shared_ptr<Ship> &actor, const shared_ptr<Ship> &target, int type)
-	: actor(actor), target(target), type(type)
+ShipEvent::ShipEvent(shared_ptr<Ship> actor, shared_ptr<Ship> target, int type)
+	: actor(std::move(actor)), target(std::move(target)), type(type)
 {
-	if(actor)
-		actorGovernment = actor->GetGovernment();
-	if(target)
-		targetGovernment = target->GetGovernment();
+	if(this->actor)
+		actorGovernment = this->actor->GetGovernment();
+	if(this->target)
+		targetGovernment = this->target->GetGovernment();
 }
 
 
@@ -0,0 +1,107 @@
+/* ShipRegistry.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "ShipRegistry.h"
+
+#include "Ship.h"
+
+using namespace std;
+
+
+
+bool ShipRegistry::Handle::operator==(const Handle &other) const
+{
+	return index == other.index && generation == other.generation;
+}
+
+
+
+bool ShipRegistry::Handle::operator!=(const Handle &other) const
+{
+	return !(*this == other);
+}
+
+
+
+void ShipRegistry::Update(const list<shared_ptr<Ship>> &shipList)
+{
+	// Mark the slots of the ships that are still in the list.
+	for(const shared_ptr<Ship> &ship : shipList)
+		if(Get(ship->RegistryHandle()) == ship.get())
+			slots[ship->RegistryHandle().index].inList = true;
+
+	// Free up the slots of any ships that have left it. Changing the generation
+	// means that old handles to those ships will no longer resolve.
+	for(uint32_t i = 0; i < slots.size(); ++i)
+	{
+		Slot &slot = slots[i];
+		if(slot.ship && !slot.inList)
+		{
+			slot.ship = nullptr;
+			++slot.generation;
+			freeSlots.push_back(i);
+		}
+		slot.inList = false;
+	}
+
+	// Give slots to the ships that are new to the list.
+	ships.clear();
+	for(const shared_ptr<Ship> &ship : shipList)
+	{
+		if(Get(ship->RegistryHandle()) != ship.get())
+		{
+			uint32_t index = slots.size();
+			if(freeSlots.empty())
+				slots.emplace_back();
+			else
+			{
+				index = freeSlots.back();
+				freeSlots.pop_back();
+			}
+			Slot &slot = slots[index];
+			slot.ship = ship.get();
+
+			Handle handle;
+			handle.index = index;
+			handle.generation = slot.generation;
+			ship->SetRegistryHandle(handle);
+		}
+		ships.push_back(ship.get());
+	}
+}
+
+
+
+void ShipRegistry::Clear()
+{
+	Update(list<shared_ptr<Ship>>());
+}
+
+
+
+Ship *ShipRegistry::Get(Handle handle) const
+{
+	if(handle.index >= slots.size())
+		return nullptr;
+	const Slot &slot = slots[handle.index];
+	return slot.generation == handle.generation ? slot.ship : nullptr;
+}
+
+
+
+const vector<Ship *> &ShipRegistry::Ships() const
+{
+	return ships;
+}
@@ -0,0 +1,80 @@
+/* ShipRegistry.h
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SHIP_REGISTRY_H_
+#define SHIP_REGISTRY_H_
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <vector>
+
+class Ship;
+
+
+
+// A flat index of the ships that are being simulated, in the same order as the
+// list they were registered from. Each registered ship is given a handle (a
+// slot index plus the generation of that slot) which can be looked up without
+// touching the ship's reference count. Once a ship is no longer in the list, its
+// slot's generation changes, so any handles to it stop resolving, even after
+// the slot has been given to another ship.
+class ShipRegistry {
+public:
+	class Handle {
+	public:
+		bool operator==(const Handle &other) const;
+		bool operator!=(const Handle &other) const;
+
+	public:
+		uint32_t index = UINT32_MAX;
+		uint32_t generation = 0;
+	};
+
+
+public:
+	// Bring the registry up to date with the given list of ships. Ships that
+	// were already registered keep their handles. This must be done while
+	// nothing else is using the registry, and any ship that is removed from the
+	// list must not be looked up again until this has been done.
+	void Update(const std::list<std::shared_ptr<Ship>> &shipList);
+	// Forget all the registered ships.
+	void Clear();
+
+	// Get the ship that the given handle refers to, or null if that ship is
+	// no longer registered.
+	Ship *Get(Handle handle) const;
+	// All the registered ships, in the same order as the list they came from.
+	const std::vector<Ship *> &Ships() const;
+
+
+private:
+	class Slot {
+	public:
+		Ship *ship = nullptr;
+		uint32_t generation = 0;
+		bool inList = false;
+	};
+
+
+private:
+	std::vector<Slot> slots;
+	std::vector<uint32_t> freeSlots;
+	std::vector<Ship *> ships;
+};
+
+
+
+#endif
@@ -36,7 +36,8 @@ public:
 	const std::string &Name() const;
 
 	// Upload the given frames. The given buffer will be cleared afterwards.
-	void AddFrames(ImageBuffer &buffer, bool is2x);
+	// If uploading is prevented, only the dimensions of the frames are kept.
+	void AddFrames(ImageBuffer &buffer, bool is2x, bool preventUpload = false);
 	// Free up all textures loaded for this sprite.
 	void Unload();
 
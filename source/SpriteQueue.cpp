@@ -121,6 +121,16 @@ void SpriteQueue::Finish()
 
 
 
+// Only load the dimensions and collision masks of the sprites, without
+// uploading anything to the GPU. This is for running without a window.
+void SpriteQueue::PreventUpload()
+{
+	unique_lock<mutex> lock(loadMutex);
+	preventUpload = true;
+}
+
+
+
 // Thread entry point.
 void SpriteQueue::operator()()
 {
@@ -185,7 +195,7 @@ void SpriteQueue::DoLoad(unique_lock<mutex> &lock)
 		// It's now safe to modify the lists.
 		lock.unlock();
 
-		imageSet->Upload(SpriteSet::Modify(imageSet->Name()));
+		imageSet->Upload(SpriteSet::Modify(imageSet->Name()), preventUpload);
 
 		lock.lock();
 		++completed;
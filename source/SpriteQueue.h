@@ -55,6 +55,9 @@ public:
 	void UploadSprites();
 	// Finish loading.
 	void Finish();
+	// Only load the dimensions and collision masks of the sprites, without
+	// uploading anything to the GPU. This is for running without a window.
+	void PreventUpload();
 
 	// Thread entry point.
 	void operator()();
@@ -76,6 +79,7 @@ private:
 	std::mutex loadMutex;
 	std::condition_variable loadCondition;
 	int completed = 0;
+	bool preventUpload = false;
 
 	// These sprites must be unloaded to reclaim GPU memory.
 	std::queue<std::string> toUnload;
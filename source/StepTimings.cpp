@@ -0,0 +1,183 @@
+/* StepTimings.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "StepTimings.h"
+
+#include "Files.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+using namespace std;
+
+namespace {
+	atomic<bool> enabled(false);
+	atomic<bool> dumpRequested(false);
+}
+
+
+
+StepTimings::Timer::Timer(StepTimings &timings)
+	: timings(enabled ? &timings : nullptr)
+{
+}
+
+
+
+StepTimings::Timer::~Timer()
+{
+	Stop();
+}
+
+
+
+void StepTimings::Timer::Start(size_t newPhase)
+{
+	if(!timings)
+		return;
+
+	chrono::steady_clock::time_point now = chrono::steady_clock::now();
+	if(running)
+		timings->Record(phase, chrono::duration<double, milli>(now - start).count());
+	phase = newPhase;
+	running = true;
+	start = now;
+}
+
+
+
+void StepTimings::Timer::Stop()
+{
+	if(!running)
+		return;
+
+	timings->Record(phase, chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+	running = false;
+}
+
+
+
+void StepTimings::SetEnabled(bool enable)
+{
+	enabled = enable;
+}
+
+
+
+bool StepTimings::IsEnabled()
+{
+	return enabled;
+}
+
+
+
+void StepTimings::RequestDump()
+{
+	dumpRequested = true;
+}
+
+
+
+bool StepTimings::TakeDumpRequest()
+{
+	return dumpRequested.exchange(false);
+}
+
+
+
+StepTimings::StepTimings(const vector<string> &phaseNames, size_t window)
+	: names(phaseNames), window(window), current(phaseNames.size()), samples(phaseNames.size() * window)
+{
+}
+
+
+
+void StepTimings::Record(size_t phase, double time)
+{
+	current[phase] += time;
+}
+
+
+
+void StepTimings::EndStep()
+{
+	if(!enabled)
+		return;
+
+	copy(current.begin(), current.end(), samples.begin() + next * names.size());
+	fill(current.begin(), current.end(), 0.);
+	next = (next + 1) % window;
+	count = min(count + 1, window);
+}
+
+
+
+size_t StepTimings::PhaseCount() const
+{
+	return names.size();
+}
+
+
+
+const string &StepTimings::PhaseName(size_t phase) const
+{
+	return names[phase];
+}
+
+
+
+StepTimings::Stats StepTimings::GetStats(size_t phase) const
+{
+	Stats stats;
+	if(!count)
+		return stats;
+
+	vector<double> times;
+	times.reserve(count);
+	for(size_t i = 0; i < count; ++i)
+		times.push_back(samples[i * names.size() + phase]);
+	sort(times.begin(), times.end());
+
+	stats.min = times.front();
+	for(double time : times)
+		stats.average += time;
+	stats.average /= count;
+	size_t index = static_cast<size_t>(ceil(.99 * count));
+	stats.p99 = times[max<size_t>(index, 1) - 1];
+	return stats;
+}
+
+
+
+void StepTimings::WriteCSV(const string &path) const
+{
+	string csv = "step";
+	for(const string &name : names)
+		csv += ',' + name;
+	csv += '\n';
+
+	// The oldest recorded step is the one that will be overwritten next.
+	size_t first = (count == window) ? next : 0;
+	for(size_t i = 0; i < count; ++i)
+	{
+		const double *row = &samples[((first + i) % window) * names.size()];
+		csv += to_string(i);
+		for(size_t phase = 0; phase < names.size(); ++phase)
+			csv += ',' + to_string(row[phase]);
+		csv += '\n';
+	}
+	Files::Write(path, csv);
+}
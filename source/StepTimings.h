@@ -0,0 +1,104 @@
+/* StepTimings.h
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef STEP_TIMINGS_H_
+#define STEP_TIMINGS_H_
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+
+// Class for measuring how long each phase of a game step takes. The timings of
+// the most recent steps are kept, so that the minimum, average, and 99th
+// percentile time of each phase can be compared to find out which of them is
+// slowing the game down. Timing is only done when it has been enabled (which
+// happens in debug mode), so it costs next to nothing otherwise.
+class StepTimings {
+public:
+	class Stats {
+	public:
+		// All times are in milliseconds.
+		double min = 0.;
+		double average = 0.;
+		double p99 = 0.;
+	};
+
+	// Times a sequence of phases. Starting a phase ends the one before it, and
+	// the last one ends when the timer is stopped or goes out of scope. A phase
+	// can be timed several times in one step; the times are added together.
+	class Timer {
+	public:
+		explicit Timer(StepTimings &timings);
+		~Timer();
+
+		Timer(const Timer &other) = delete;
+		Timer &operator=(const Timer &other) = delete;
+
+		void Start(size_t phase);
+		void Stop();
+
+	private:
+		StepTimings *timings;
+		size_t phase = 0;
+		bool running = false;
+		std::chrono::steady_clock::time_point start;
+	};
+
+
+public:
+	// Turn timing on or off for all instances.
+	static void SetEnabled(bool enabled);
+	static bool IsEnabled();
+	// Ask for the timings to be written to a file. The owner of the timings
+	// checks for this when it is safe to read them.
+	static void RequestDump();
+	static bool TakeDumpRequest();
+
+	// Create timings for the given phases, keeping the given number of steps.
+	explicit StepTimings(const std::vector<std::string> &phaseNames, size_t window = 600);
+
+	// Add the given time, in milliseconds, to a phase of the step in progress.
+	void Record(size_t phase, double time);
+	// Record the times of the phases in the step that just ended.
+	void EndStep();
+
+	size_t PhaseCount() const;
+	const std::string &PhaseName(size_t phase) const;
+	// Get the statistics for one phase over the recorded steps.
+	Stats GetStats(size_t phase) const;
+
+	// Write the time of every phase in each of the recorded steps, from the
+	// oldest to the newest, to the given file as comma-separated values.
+	void WriteCSV(const std::string &path) const;
+
+
+private:
+	std::vector<std::string> names;
+	size_t window;
+
+	// The times for the step that is in progress.
+	std::vector<double> current;
+	// The times of the recorded steps, one row per step, in a ring buffer.
+	std::vector<double> samples;
+	size_t count = 0;
+	size_t next = 0;
+};
+
+
+
+#endif
@@ -29,6 +29,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include <SDL2/SDL.h>
 
 #include <algorithm>
+#include <cmath>
 #include <map>
 #include <numeric>
 #include <set>
@@ -54,6 +55,7 @@ namespace {
 		{Test::TestStep::Type::INPUT, "input"},
 		{Test::TestStep::Type::LABEL, "label"},
 		{Test::TestStep::Type::NAVIGATE, "navigate"},
+		{Test::TestStep::Type::TIMING, "timing"},
 		{Test::TestStep::Type::WATCHDOG, "watchdog"},
 	};
 
@@ -99,6 +101,29 @@ namespace {
 		return SDL_PushEvent(&event);
 	}
 
+	// Check if the given name is a statistic of the step times that a timing
+	// step can put a budget on: "average", "max", or a percentile like "p95".
+	bool IsTimingStatistic(const string &name)
+	{
+		if(name == "average" || name == "max")
+			return true;
+		if(name.size() < 2 || name[0] != 'p' || !DataNode::IsNumber(name.substr(1)))
+			return false;
+		double percentile = DataNode::Value(name.substr(1));
+		return percentile > 0. && percentile <= 100.;
+	}
+
+	// Get the value of the given statistic for the given (sorted) step times.
+	double TimingStatistic(const vector<double> &times, const string &name)
+	{
+		if(name == "average")
+			return accumulate(times.begin(), times.end(), 0.) / times.size();
+
+		double percentile = (name == "max") ? 100. : DataNode::Value(name.substr(1));
+		size_t index = static_cast<size_t>(ceil(percentile * .01 * times.size()));
+		return times[max<size_t>(index, 1) - 1];
+	}
+
 	string ShipToString(const Ship &ship)
 	{
 		string description = "name: " + ship.Name();
@@ -286,6 +311,32 @@ void Test::LoadSequence(const DataNode &node)
 					}
 				}
 				break;
+			case TestStep::Type::TIMING:
+				if(child.Size() < 2 || child.Value(1) < 1.)
+				{
+					status = Status::BROKEN;
+					child.PrintTrace("Error: Invalid use of \"timing\" without a number of steps to time:");
+					return;
+				}
+				step.timingSteps = child.Value(1);
+				for(const DataNode &grand : child)
+				{
+					if(grand.Size() < 2 || !IsTimingStatistic(grand.Token(0)))
+					{
+						status = Status::BROKEN;
+						grand.PrintTrace("Error: Invalid step time budget (expected \"average\", \"max\", or a percentile"
+							" like \"p95\", followed by a time in milliseconds):");
+						return;
+					}
+					step.timingBudgets.emplace_back(grand.Token(0), grand.Value(1));
+				}
+				if(step.timingBudgets.empty())
+				{
+					status = Status::BROKEN;
+					child.PrintTrace("Error: Invalid use of \"timing\" without any budget for the step times:");
+					return;
+				}
+				break;
 			case TestStep::Type::WATCHDOG:
 				step.watchdog = child.Size() >= 2 ? child.Value(1) : 0;
 				break;
@@ -430,6 +481,9 @@ void Test::Step(TestContext &context, PlayerInfo &player, Command &commandToGive
 
 	// All processing was done just before this step started.
 	context.branchesSinceGameStep.clear();
+	// If the engine just finished a step, it told us how long that took.
+	double stepTime = context.stepTime;
+	context.stepTime = -1.;
 
 	while(context.callstack.back().step < steps.size() && !continueGameLoop)
 	{
@@ -513,6 +567,23 @@ void Test::Step(TestContext &context, PlayerInfo &player, Command &commandToGive
 				player.SetTravelDestination(stepToRun.travelDestination);
 				++(context.callstack.back().step);
 				break;
+			case TestStep::Type::TIMING:
+				// Only the steps that the engine calculated while in flight are
+				// timed, so wait until enough of them have passed.
+				if(stepTime >= 0.)
+				{
+					context.stepTimes.push_back(stepTime);
+					stepTime = -1.;
+				}
+				if(context.stepTimes.size() < stepToRun.timingSteps)
+				{
+					continueGameLoop = true;
+					break;
+				}
+				CheckTimingBudgets(context, player, stepToRun);
+				context.stepTimes.clear();
+				++(context.callstack.back().step);
+				break;
 			case TestStep::Type::WATCHDOG:
 				context.watchdog = stepToRun.watchdog;
 				++(context.callstack.back().step);
@@ -568,6 +639,30 @@ std::set<std::string> Test::RelevantConditions() const
 
 
 
+// Check the step times collected by a timing step against its budgets.
+void Test::CheckTimingBudgets(const TestContext &context, const PlayerInfo &player, const TestStep &step) const
+{
+	vector<double> times = context.stepTimes;
+	sort(times.begin(), times.end());
+
+	string summary = "over " + to_string(times.size()) + " steps: average "
+		+ Format::Decimal(TimingStatistic(times, "average"), 3) + " ms, p95 "
+		+ Format::Decimal(TimingStatistic(times, "p95"), 3) + " ms, max "
+		+ Format::Decimal(TimingStatistic(times, "max"), 3) + " ms";
+	// Print the times even if they are within budget, so that they can be tracked over time.
+	Logger::LogError("Test \"" + name + "\": step times " + summary + ".");
+
+	for(const auto &budget : step.timingBudgets)
+	{
+		double time = TimingStatistic(times, budget.first);
+		if(time > budget.second)
+			Fail(context, player, budget.first + " step time of " + Format::Decimal(time, 3)
+				+ " ms is over the budget of " + Format::Number(budget.second) + " ms (" + summary + ")");
+	}
+}
+
+
+
 // Fail the test using the given message as reason.
 void Test::Fail(const TestContext &context, const PlayerInfo &player, const string &testFailReason) const
 {
@@ -24,6 +24,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include <map>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 class DataNode;
@@ -70,6 +71,9 @@ public:
 			LABEL,
 			// Instructs the game to set navigation / travel plan to a target system
 			NAVIGATE,
+			// Times the given number of game steps, and fails if the step times go over any of the
+			// budgets given (e.g. "p95 8" for a 95th percentile of 8 ms). Does cause the game to step.
+			TIMING,
 			// Sets the watchdog timer. No value or zero disables the watchdog. Non-zero gives
 			// a watchdog in number of frames/steps.
 			WATCHDOG,
@@ -100,6 +104,11 @@ public:
 
 		unsigned int watchdog = 0;
 
+		// Variables for timing steps: the number of game steps to time, and the
+		// budgets in milliseconds for "average", "max", or percentiles like "p95".
+		unsigned int timingSteps = 0;
+		std::vector<std::pair<std::string, double>> timingBudgets;
+
 		// Input variables.
 		Command command;
 		std::set<std::string> inputKeys;
@@ -128,6 +137,8 @@ public:
 
 private:
 	void LoadSequence(const DataNode &node);
+	// Check the step times collected by a timing step against its budgets.
+	void CheckTimingBudgets(const TestContext &context, const PlayerInfo &player, const TestStep &step) const;
 
 	// Fail the test using the given message as reason.
 	void Fail(const TestContext &context, const PlayerInfo &player, const std::string &testFailReason) const;
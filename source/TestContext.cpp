@@ -33,6 +33,13 @@ const Test *TestContext::CurrentTest() const noexcept
 
 
 
+void TestContext::SetStepTime(double milliseconds)
+{
+	stepTime = milliseconds;
+}
+
+
+
 bool TestContext::ActiveTestStep::operator==(const ActiveTestStep &rhs) const
 {
 	return test == rhs.test && step == rhs.step;
@@ -28,6 +28,9 @@ public:
 	TestContext() = default;
 	TestContext(const Test *toRun);
 	const Test *CurrentTest() const noexcept;
+	// Give the time that the engine took to calculate the step that just ended,
+	// for tests that check how long the steps take.
+	void SetStepTime(double milliseconds);
 
 
 private:
@@ -51,6 +54,12 @@ private:
 	// Teststep to run.
 	unsigned int watchdog = 0;
 	std::set<ActiveTestStep> branchesSinceGameStep;
+
+	// The time of the engine step that just ended, in milliseconds, or a
+	// negative value if there was no engine step since the last test step.
+	double stepTime = -1.;
+	// The step times collected so far by the running "timing" step.
+	std::vector<double> stepTimes;
 };
 
 #endif
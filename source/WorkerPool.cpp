@@ -0,0 +1,128 @@
+/* WorkerPool.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "WorkerPool.h"
+
+#include "Random.h"
+
+#include <algorithm>
+
+using namespace std;
+
+
+
+// Constructor, which starts the worker threads.
+WorkerPool::WorkerPool(unsigned threadCount)
+	: nextIndex(0)
+{
+	threads.resize(threadCount);
+	for(thread &t : threads)
+		t = thread(ref(*this));
+}
+
+
+
+// Destructor, which tells the worker threads to quit and waits for them.
+WorkerPool::~WorkerPool()
+{
+	{
+		lock_guard<mutex> lock(workMutex);
+		quit = true;
+	}
+	workCondition.notify_all();
+	for(thread &t : threads)
+		t.join();
+}
+
+
+
+// Call the given function once for every index from 0 to count - 1.
+void WorkerPool::Run(size_t count, const function<void(size_t)> &task)
+{
+	// Small amounts of work aren't worth waking up the other threads for.
+	if(threads.empty() || count < 2)
+	{
+		for(size_t i = 0; i < count; ++i)
+			task(i);
+		return;
+	}
+
+	{
+		lock_guard<mutex> lock(workMutex);
+		this->task = &task;
+		taskSize = count;
+		nextIndex = 0;
+		busy = threads.size();
+		++generation;
+	}
+	workCondition.notify_all();
+
+	// This thread helps out, then waits for the others to finish.
+	Work();
+
+	unique_lock<mutex> lock(workMutex);
+	while(busy)
+		doneCondition.wait(lock);
+	this->task = nullptr;
+}
+
+
+
+unsigned WorkerPool::ThreadCount() const
+{
+	return threads.size();
+}
+
+
+
+unsigned WorkerPool::DefaultThreadCount()
+{
+	// The hardware concurrency may be reported as 0 if it is unknown.
+	return max(1u, thread::hardware_concurrency()) - 1;
+}
+
+
+
+// Thread entry point.
+void WorkerPool::operator()()
+{
+	Random::ThreadGuard randomGuard;
+	uint64_t finished = 0;
+	unique_lock<mutex> lock(workMutex);
+	while(true)
+	{
+		while(!quit && generation == finished)
+			workCondition.wait(lock);
+		if(quit)
+			return;
+
+		finished = generation;
+		lock.unlock();
+		Work();
+		lock.lock();
+
+		if(!--busy)
+			doneCondition.notify_one();
+	}
+}
+
+
+
+// Keep claiming indices of the current task until there are none left.
+void WorkerPool::Work()
+{
+	for(size_t i = nextIndex++; i < taskSize; i = nextIndex++)
+		(*task)(i);
+}
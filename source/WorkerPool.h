@@ -0,0 +1,85 @@
+/* WorkerPool.h
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef WORKER_POOL_H_
+#define WORKER_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+
+// Class for splitting up independent pieces of work within a single game step
+// (e.g. the calculations for each ship) across a set of worker threads. The
+// thread that hands out the work also takes part in it, and does not return
+// until all of the work is done, so the results can be used right away.
+class WorkerPool {
+public:
+	// Create a pool with the given number of worker threads. By default, use
+	// every available core besides the one that hands out the work.
+	explicit WorkerPool(unsigned threadCount = DefaultThreadCount());
+	~WorkerPool();
+
+	// No moving or copying this class.
+	WorkerPool(const WorkerPool &other) = delete;
+	WorkerPool(WorkerPool &&other) = delete;
+	WorkerPool &operator=(const WorkerPool &other) = delete;
+	WorkerPool &operator=(WorkerPool &&other) = delete;
+
+	// Call the given function once for every index from 0 to count - 1. The
+	// indices are handed out in no particular order, so each call must only
+	// modify data that belongs to its own index.
+	void Run(size_t count, const std::function<void(size_t)> &task);
+
+	// Get the number of worker threads, not counting the calling thread.
+	unsigned ThreadCount() const;
+	static unsigned DefaultThreadCount();
+
+	// Thread entry point.
+	void operator()();
+
+
+private:
+	void Work();
+
+
+private:
+	// The task that is currently being worked on, if any.
+	const std::function<void(size_t)> *task = nullptr;
+	size_t taskSize = 0;
+	std::atomic<size_t> nextIndex;
+
+	// Each new task increments the generation, which wakes up the workers.
+	uint64_t generation = 0;
+	// The number of worker threads that have not yet finished the current task.
+	unsigned busy = 0;
+	bool quit = false;
+
+	std::mutex workMutex;
+	std::condition_variable workCondition;
+	std::condition_variable doneCondition;
+
+	std::vector<std::thread> threads;
+};
+
+
+
+#endif
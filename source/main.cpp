@@ -30,6 +30,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "GameLoadingPanel.h"
 #include "GameWindow.h"
 #include "Hardpoint.h"
+#include "HeadlessSimulation.h"
 #include "Logger.h"
 #include "MenuPanel.h"
 #include "Panel.h"
@@ -37,19 +38,24 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "Plugins.h"
 #include "Preferences.h"
 #include "PrintData.h"
+#include "Replay.h"
 #include "Screen.h"
 #include "SpriteSet.h"
 #include "SpriteShader.h"
+#include "StepTimings.h"
 #include "Test.h"
 #include "TestContext.h"
 #include "UI.h"
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <thread>
 
 #include <cassert>
+#include <cstdlib>
 #include <future>
 #include <stdexcept>
 #include <string>
@@ -94,6 +100,10 @@ int main(int argc, char *argv[])
 	bool printData = false;
 	bool noTestMute = false;
 	string testToRunName = "";
+	int simulateSteps = 0;
+	const char *simulateArgument = nullptr;
+	string saveToSimulate;
+	string replayToPlay;
 
 	// Ensure that we log errors to the errors.txt file.
 	Logger::SetLogErrorCallback([](const string &errorMessage) { Files::LogErrorToFile(errorMessage); });
@@ -123,21 +133,45 @@ int main(int argc, char *argv[])
 			printTests = true;
 		else if(arg == "--nomute")
 			noTestMute = true;
+		else if(arg == "--simulate" && *++it)
+			simulateArgument = *it;
+		else if(arg == "--save" && *++it)
+			saveToSimulate = *it;
+		else if(arg == "--record" && *++it)
+			Replay::SetRecordPath(*it);
+		else if(arg == "--replay" && *++it)
+			replayToPlay = *it;
 	}
 	printData = PrintData::IsPrintDataArgument(argv);
 	Files::Init(argv);
 
+	if(simulateArgument)
+	{
+		char *end = nullptr;
+		long steps = strtol(simulateArgument, &end, 10);
+		if(*end || steps < 1 || steps > numeric_limits<int>::max())
+		{
+			Logger::LogError("The number of steps to simulate must be a positive whole number, not \""
+				+ string(simulateArgument) + "\".");
+			return 1;
+		}
+		simulateSteps = static_cast<int>(steps);
+	}
+
 	try {
 		// Load plugin preferences before game data if any.
 		Plugins::LoadSettings();
 
 		// Begin loading the game data.
 		bool isConsoleOnly = loadOnly || printTests || printData;
-		future<void> dataLoading = GameData::BeginLoad(isConsoleOnly, debugMode);
+		// A headless simulation needs the sizes and collision masks of the sprites,
+		// but has no window to upload them to.
+		bool isHeadless = (simulateSteps > 0 || !replayToPlay.empty());
+		future<void> dataLoading = GameData::BeginLoad(isConsoleOnly, debugMode, isHeadless);
 
 		// If we are not using the UI, or performing some automated task, we should load
 		// all data now. (Sprites and sounds can safely be deferred.)
-		if(isConsoleOnly || !testToRunName.empty())
+		if(isConsoleOnly || isHeadless || !testToRunName.empty())
 			dataLoading.wait();
 
 		if(!testToRunName.empty() && !GameData::Tests().Has(testToRunName))
@@ -158,6 +192,10 @@ int main(int argc, char *argv[])
 		}
 
 		PlayerInfo player;
+		if(!replayToPlay.empty())
+			return HeadlessSimulation::Play(player, replayToPlay);
+		if(isHeadless)
+			return HeadlessSimulation::Run(player, saveToSimulate, simulateSteps);
 		if(loadOnly)
 		{
 			// Set the game's initial internal state.
@@ -257,6 +295,9 @@ void GameLoop(PlayerInfo &player, const Conversation &conversation, const string
 	bool isFastForward = false;
 	int testDebugUIDelay = UI_DELAY;
 
+	// In debug mode, keep track of how long each phase of a game step takes.
+	StepTimings::SetEnabled(debugMode);
+
 	// If fast forwarding, keep track of whether the current frame should be drawn.
 	int skipFrame = 0;
 
@@ -287,7 +328,11 @@ void GameLoop(PlayerInfo &player, const Conversation &conversation, const string
 
 			if(debugMode && event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_BACKQUOTE)
 			{
-				isPaused = !isPaused;
+				// Shift + backquote writes out the step timings instead of pausing.
+				if(event.key.keysym.mod & KMOD_SHIFT)
+					StepTimings::RequestDump();
+				else
+					isPaused = !isPaused;
 			}
 			else if(event.type == SDL_KEYDOWN && menuPanels.IsEmpty()
 					&& Command(event.key.keysym.sym).Has(Command::MENU)
@@ -447,6 +492,7 @@ void PrintHelp()
 	cerr << "    --tests: print table of available tests, then exit." << endl;
 	cerr << "    --test <name>: run given test from resources directory." << endl;
 	cerr << "    --nomute: don't mute the game while running tests." << endl;
+	HeadlessSimulation::Help();
 	PrintData::Help();
 	cerr << endl;
 	cerr << "Report bugs to: <https://github.com/endless-sky/endless-sky/issues>" << endl;
@@ -0,0 +1,69 @@
+/* ShipDerivedStats.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "ShipDerivedStats.h"
+
+#include "../AttributeKeys.h"
+#include "../Dictionary.h"
+#include "../Outfit.h"
+
+#include <cmath>
+
+using namespace AttributeKeys;
+using namespace std;
+
+
+
+void ShipDerivedStats::Calibrate(const Outfit &attributes)
+{
+	hullRepair = attributes.Get(HULL_REPAIR_RATE) * (1. + attributes.Get(HULL_REPAIR_MULTIPLIER));
+	hullEnergy = (attributes.Get(HULL_ENERGY) * (1. + attributes.Get(HULL_ENERGY_MULTIPLIER))) / hullRepair;
+	hullFuel = (attributes.Get(HULL_FUEL) * (1. + attributes.Get(HULL_FUEL_MULTIPLIER))) / hullRepair;
+	hullHeat = (attributes.Get(HULL_HEAT) * (1. + attributes.Get(HULL_HEAT_MULTIPLIER))) / hullRepair;
+
+	shieldGeneration = attributes.Get(SHIELD_GENERATION) * (1. + attributes.Get(SHIELD_GENERATION_MULTIPLIER));
+	shieldEnergy = (attributes.Get(SHIELD_ENERGY) * (1. + attributes.Get(SHIELD_ENERGY_MULTIPLIER)))
+		/ shieldGeneration;
+	shieldFuel = (attributes.Get(SHIELD_FUEL) * (1. + attributes.Get(SHIELD_FUEL_MULTIPLIER))) / shieldGeneration;
+	shieldHeat = (attributes.Get(SHIELD_HEAT) * (1. + attributes.Get(SHIELD_HEAT_MULTIPLIER))) / shieldGeneration;
+
+	netEnergyGeneration = attributes.Get(ENERGY_GENERATION) - attributes.Get(ENERGY_CONSUMPTION);
+	fuelGeneration = attributes.Get(FUEL_GENERATION);
+	heatGeneration = attributes.Get(HEAT_GENERATION);
+	fuelConsumption = attributes.Get(FUEL_CONSUMPTION);
+	fuelEnergy = attributes.Get(FUEL_ENERGY);
+	fuelHeat = attributes.Get(FUEL_HEAT);
+	ramscoop = attributes.Get(RAMSCOOP);
+	solarCollection = attributes.Get(SOLAR_COLLECTION);
+	solarHeat = attributes.Get(SOLAR_HEAT);
+
+	// This is an S-curve where the efficiency is 100% if you have no outfits
+	// that create "cooling inefficiency", and as that value increases the
+	// efficiency stays high for a while, then drops off, then approaches 0.
+	double x = attributes.Get(COOLING_INEFFICIENCY);
+	coolingEfficiency = 2. + 2. / (1. + exp(x / -2.)) - 4. / (1. + exp(x / -4.));
+	cooling = attributes.Get(COOLING);
+	activeCooling = attributes.Get(ACTIVE_COOLING);
+	coolingEnergy = attributes.Get(COOLING_ENERGY);
+	heatDissipation = .001 * attributes.Get(HEAT_DISSIPATION);
+	heatCapacity = attributes.Get(HEAT_CAPACITY);
+
+	thrust = attributes.Get(THRUST);
+	reverseThrust = attributes.Get(REVERSE_THRUST);
+	afterburnerThrust = attributes.Get(AFTERBURNER_THRUST);
+	turn = attributes.Get(TURN);
+	drag = attributes.Get(DRAG) / (1. + attributes.Get(DRAG_REDUCTION));
+	inertiaDivisor = 1. + attributes.Get(INERTIA_REDUCTION);
+}
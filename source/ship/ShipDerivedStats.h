@@ -0,0 +1,76 @@
+/* ShipDerivedStats.h
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SHIP_DERIVED_STATS_H_
+#define SHIP_DERIVED_STATS_H_
+
+class Outfit;
+
+
+
+// A class which caches the values a ship needs every step that are derived
+// from its attributes, so that they only need to be calculated again when the
+// ship's attributes change (i.e. when outfits are added or removed).
+class ShipDerivedStats {
+public:
+	ShipDerivedStats() = default;
+
+	void Calibrate(const Outfit &attributes);
+
+
+public:
+	// Hull repair and shield generation per frame, including multipliers, and
+	// what each point repaired or generated costs.
+	double hullRepair = 0.;
+	double hullEnergy = 0.;
+	double hullFuel = 0.;
+	double hullHeat = 0.;
+	double shieldGeneration = 0.;
+	double shieldEnergy = 0.;
+	double shieldFuel = 0.;
+	double shieldHeat = 0.;
+
+	// Energy, fuel, and heat produced or consumed every frame.
+	double netEnergyGeneration = 0.;
+	double fuelGeneration = 0.;
+	double heatGeneration = 0.;
+	double fuelConsumption = 0.;
+	double fuelEnergy = 0.;
+	double fuelHeat = 0.;
+	double ramscoop = 0.;
+	double solarCollection = 0.;
+	double solarHeat = 0.;
+
+	// Cooling. The cooling efficiency already accounts for any inefficiency,
+	// but the cooling values are not yet multiplied by it.
+	double coolingEfficiency = 1.;
+	double cooling = 0.;
+	double activeCooling = 0.;
+	double coolingEnergy = 0.;
+	double heatDissipation = 0.;
+	double heatCapacity = 0.;
+
+	// Movement. The inertia divisor converts mass into inertial mass.
+	double thrust = 0.;
+	double reverseThrust = 0.;
+	double afterburnerThrust = 0.;
+	double turn = 0.;
+	double drag = 0.;
+	double inertiaDivisor = 1.;
+};
+
+
+
+#endif
@@ -0,0 +1,37 @@
+/* resource-data.h
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef ES_BENCHMARK_HELPER_RESOURCE_DATA_H_
+#define ES_BENCHMARK_HELPER_RESOURCE_DATA_H_
+
+#include "../../../source/DataNode.h"
+
+#include <string>
+#include <vector>
+
+
+
+// The benchmarks are run from the tests directory, just like the unit tests, so
+// the game's own data is found one directory up. Convert a path relative to the
+// resources (e.g. "data/human/ships.txt") into one that can be opened.
+std::string ResourcePath(const std::string &path);
+// Read the entire contents of a resource file.
+std::string ReadResource(const std::string &path);
+// Parse a resource file and return its root nodes.
+std::vector<DataNode> LoadResource(const std::string &path);
+
+
+
+#endif
@@ -0,0 +1,128 @@
+/* bench_collisionSet.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the benchmarked class's header.
+#include "../../../source/CollisionSet.h"
+
+// Include Body and Point, to have something to put in the set.
+#include "../../../source/Body.h"
+#include "../../../source/Point.h"
+
+// ... and any system includes needed for the benchmark file.
+#include <vector>
+
+namespace { // benchmark namespace
+
+// #region mock data
+
+// The cell size and count that the engine uses for ships.
+const unsigned CELL_SIZE = 256;
+const unsigned CELL_COUNT = 32;
+
+// Spread bodies out over an area about the size of a busy battle. Bodies
+// without a sprite act as single points.
+std::vector<Body> MakeBodies(int count)
+{
+	std::vector<Body> bodies;
+	bodies.reserve(count);
+	for(int i = 0; i < count; ++i)
+		bodies.emplace_back(nullptr, Point((i * 173) % 8000 - 4000, (i * 389) % 6000 - 3000));
+	return bodies;
+}
+
+Point QueryCenter(int i)
+{
+	return Point((i * 97) % 8000 - 4000, (i * 61) % 6000 - 3000);
+}
+
+void Fill(CollisionSet &set, std::vector<Body> &bodies)
+{
+	set.Clear(1);
+	for(Body &body : bodies)
+		set.Add(body);
+	set.Finish();
+}
+
+// #endregion mock data
+
+
+
+// #region benchmarks
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE( "Benchmark CollisionSet", "[benchmark][collisionSet]" ) {
+	std::vector<Body> bodies = MakeBodies(1000);
+	CollisionSet set(CELL_SIZE, CELL_COUNT);
+	Fill(set, bodies);
+	REQUIRE( set.All().size() == bodies.size() );
+
+	BENCHMARK( "Add and Finish 1000 bodies" ) {
+		Fill(set, bodies);
+		return set.All().size();
+	};
+
+	CollisionSet adaptive(CELL_SIZE, CELL_COUNT, true);
+	Fill(adaptive, bodies);
+	BENCHMARK( "Add and Finish 1000 bodies in an adaptive set" ) {
+		Fill(adaptive, bodies);
+		return adaptive.All().size();
+	};
+
+	BENCHMARK( "100 short lines, like projectiles" ) {
+		int hits = 0;
+		for(int i = 0; i < 100; ++i)
+		{
+			Point from = QueryCenter(i);
+			hits += (set.Line(from, from + Point(30., -20.)) != nullptr);
+		}
+		return hits;
+	};
+	BENCHMARK( "100 long lines, like the auto-firing AI's" ) {
+		int hits = 0;
+		for(int i = 0; i < 100; ++i)
+		{
+			Point from = QueryCenter(i);
+			hits += (set.Line(from, from + Point(900., 600.)) != nullptr);
+		}
+		return hits;
+	};
+
+	std::vector<Body *> result;
+	BENCHMARK( "100 circles, like blast radii" ) {
+		size_t found = 0;
+		for(int i = 0; i < 100; ++i)
+		{
+			set.Circle(QueryCenter(i), 200., result);
+			found += result.size();
+		}
+		return found;
+	};
+	BENCHMARK( "100 circles, like scanning ranges" ) {
+		size_t found = 0;
+		for(int i = 0; i < 100; ++i)
+		{
+			set.Circle(QueryCenter(i), 1500., result);
+			found += result.size();
+		}
+		return found;
+	};
+}
+#endif
+// #endregion benchmarks
+
+
+
+} // benchmark namespace
@@ -0,0 +1,113 @@
+/* bench_conditionSet.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the benchmarked class's header.
+#include "../../../source/ConditionSet.h"
+
+// Include helpers for creating the conditions to test.
+#include "../../../source/ConditionsStore.h"
+#include "datanode-factory.h"
+#include "resource-data.h"
+
+// ... and any system includes needed for the benchmark file.
+#include <string>
+#include <vector>
+
+namespace { // benchmark namespace
+
+// #region mock data
+
+// The files with the most missions in them.
+const std::vector<std::string> MISSION_FILES = {
+	"data/human/human missions.txt",
+	"data/human/jobs.txt",
+	"data/human/free worlds 1 start.txt",
+	"data/human/free worlds 2 middle.txt",
+};
+
+// A condition set that uses each kind of expression: comparisons, arithmetic,
+// nested "and" and "or", and checks for conditions being set.
+const std::string SYNTHETIC_CONDITIONS = R"(and
+	"combat rating" > 100
+	"day" + "month" * 31 >= 200
+	or
+		has "event: war begins"
+		not "main plot: done"
+	"reputation: Republic" >= -10
+	"cargo space" - "cargo used" > 20
+)";
+
+// The conditions that a player partway through the game might have set.
+ConditionsStore PlayerConditions()
+{
+	ConditionsStore store;
+	store.Set("combat rating", 2500);
+	store.Set("day", 12);
+	store.Set("month", 7);
+	store.Set("year", 3015);
+	store.Set("reputation: Republic", 50);
+	store.Set("cargo space", 120);
+	store.Set("cargo used", 40);
+	store.Set("event: war begins", 1);
+	for(int i = 0; i < 500; ++i)
+		store.Set("synthetic mission " + std::to_string(i) + ": done", 1);
+	return store;
+}
+
+// The conditions for offering every mission in the given files.
+std::vector<ConditionSet> ShippedOffers()
+{
+	std::vector<ConditionSet> result;
+	for(const std::string &path : MISSION_FILES)
+		for(const DataNode &node : LoadResource(path))
+			if(node.Token(0) == "mission")
+				for(const DataNode &child : node)
+					if(child.Size() >= 2 && child.Token(0) == "to" && child.Token(1) == "offer")
+						result.emplace_back(child);
+	return result;
+}
+
+// #endregion mock data
+
+
+
+// #region benchmarks
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE( "Benchmark ConditionSet::Test", "[benchmark][conditionSet]" ) {
+	const ConditionsStore store = PlayerConditions();
+	const ConditionSet synthetic(AsDataNode(SYNTHETIC_CONDITIONS));
+	REQUIRE( synthetic.Test(store) );
+
+	BENCHMARK( "A synthetic set of every kind of expression" ) {
+		return synthetic.Test(store);
+	};
+
+	const std::vector<ConditionSet> offers = ShippedOffers();
+	REQUIRE_FALSE( offers.empty() );
+	BENCHMARK( "The offer conditions of " + std::to_string(offers.size()) + " shipped missions" ) {
+		int count = 0;
+		for(const ConditionSet &offer : offers)
+			count += offer.Test(store);
+		return count;
+	};
+}
+#endif
+// #endregion benchmarks
+
+
+
+} // benchmark namespace
@@ -0,0 +1,104 @@
+/* bench_dataFile.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the benchmarked class's header.
+#include "../../../source/DataFile.h"
+
+// Include a helper for reading the game's own data.
+#include "resource-data.h"
+
+// ... and any system includes needed for the benchmark file.
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace { // benchmark namespace
+
+// #region mock data
+
+// The files that take the longest to parse when the game starts.
+const std::vector<std::string> SHIPPED_FILES = {
+	"data/human/ships.txt",
+	"data/human/outfits.txt",
+	"data/human/human missions.txt",
+	"data/map systems.txt",
+};
+
+// Write ship definitions that use every kind of token and nesting that the
+// parser has to handle: quoted and backquoted strings, numbers, and comments.
+std::string SyntheticShips(int count)
+{
+	std::ostringstream out;
+	for(int i = 0; i < count; ++i)
+	{
+		out << "ship \"Synthetic Ship " << i << "\"\n";
+		out << "\t# This comment is skipped by the parser.\n";
+		out << "\tsprite \"ship/synthetic\"\n";
+		out << "\tattributes\n";
+		out << "\t\tcategory \"Medium Warship\"\n";
+		out << "\t\t\"cost\" " << 100000 + 17 * i << "\n";
+		out << "\t\t\"shields\" " << 2000.5 + i << "\n";
+		out << "\t\t\"hull\" " << 1000 + .25 * i << "\n";
+		out << "\t\t\"heat dissipation\" .6\n";
+		out << "\toutfits\n";
+		out << "\t\t\"Heavy Laser\" 2\n";
+		out << "\t\t`\"Bullfrog\" Anti-Missile`\n";
+		out << "\tengine -12 " << 80 + i % 20 << "\n";
+		out << "\tgun -9 -40 \"Heavy Laser\"\n";
+		out << "\tdescription `A ship that only exists to be parsed, number " << i << ".`\n";
+	}
+	return out.str();
+}
+
+// Parse the given text, and return how many root nodes it has.
+long ParseAndCount(const std::string &text)
+{
+	std::istringstream in(text);
+	const DataFile file(in);
+	return std::distance(file.begin(), file.end());
+}
+
+// #endregion mock data
+
+
+
+// #region benchmarks
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE( "Benchmark DataFile parsing", "[benchmark][dataFile]" ) {
+	const std::string synthetic = SyntheticShips(1000);
+	REQUIRE( ParseAndCount(synthetic) == 1000 );
+	BENCHMARK( "1000 synthetic ships" ) {
+		return ParseAndCount(synthetic);
+	};
+
+	// The files are read ahead of time, so that only the parsing is measured.
+	for(const std::string &path : SHIPPED_FILES)
+	{
+		const std::string text = ReadResource(path);
+		REQUIRE( ParseAndCount(text) > 0 );
+		BENCHMARK( "Parse " + path ) {
+			return ParseAndCount(text);
+		};
+	}
+}
+#endif
+// #endregion benchmarks
+
+
+
+} // benchmark namespace
@@ -0,0 +1,117 @@
+/* bench_dictionary.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the benchmarked class's header.
+#include "../../../source/Dictionary.h"
+
+// Include a helper for reading the game's own data.
+#include "resource-data.h"
+
+// ... and any system includes needed for the benchmark file.
+#include <string>
+#include <vector>
+
+namespace { // benchmark namespace
+
+// #region mock data
+
+// Attributes that are looked up in every step for every ship.
+const std::vector<std::string> COMMON_ATTRIBUTES = {
+	"mass", "drag", "thrust", "turn", "reverse thrust", "afterburner thrust",
+	"energy capacity", "energy generation", "heat generation", "cooling",
+	"shield generation", "hull repair rate", "fuel capacity", "cloak", "jump speed",
+};
+
+const Dictionary::Key MASS("mass");
+const Dictionary::Key THRUST("thrust");
+const Dictionary::Key COOLING("cooling");
+const Dictionary::Key SHIELD_GENERATION("shield generation");
+
+// A dictionary with the given number of made-up attributes, plus the common ones.
+Dictionary SyntheticAttributes(int count)
+{
+	Dictionary dictionary;
+	for(int i = 0; i < count; ++i)
+		dictionary["synthetic attribute " + std::to_string(i)] = i;
+	for(const std::string &name : COMMON_ATTRIBUTES)
+		dictionary[name] = 1.;
+	return dictionary;
+}
+
+// The attributes of every outfit in the game's data.
+std::vector<Dictionary> ShippedAttributes()
+{
+	std::vector<Dictionary> result;
+	for(const DataNode &node : LoadResource("data/human/outfits.txt"))
+	{
+		if(node.Token(0) != "outfit")
+			continue;
+		result.emplace_back();
+		for(const DataNode &child : node)
+			if(child.Size() >= 2 && child.IsNumber(1))
+				result.back()[child.Token(0)] = child.Value(1);
+	}
+	return result;
+}
+
+// #endregion mock data
+
+
+
+// #region benchmarks
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE( "Benchmark Dictionary::Get", "[benchmark][dictionary]" ) {
+	const Dictionary synthetic = SyntheticAttributes(100);
+	const std::vector<Dictionary> outfits = ShippedAttributes();
+	REQUIRE_FALSE( outfits.empty() );
+
+	BENCHMARK( "Common attributes, by string" ) {
+		double sum = 0.;
+		for(const std::string &name : COMMON_ATTRIBUTES)
+			sum += synthetic.Get(name);
+		return sum;
+	};
+	BENCHMARK( "Common attributes, by character array" ) {
+		double sum = 0.;
+		for(const std::string &name : COMMON_ATTRIBUTES)
+			sum += synthetic.Get(name.c_str());
+		return sum;
+	};
+	BENCHMARK( "Common attributes, by key" ) {
+		return synthetic.Get(MASS) + synthetic.Get(THRUST) + synthetic.Get(COOLING)
+			+ synthetic.Get(SHIELD_GENERATION);
+	};
+	BENCHMARK( "Common attributes of every shipped outfit, by string" ) {
+		double sum = 0.;
+		for(const Dictionary &outfit : outfits)
+			for(const std::string &name : COMMON_ATTRIBUTES)
+				sum += outfit.Get(name);
+		return sum;
+	};
+	BENCHMARK( "Common attributes of every shipped outfit, by key" ) {
+		double sum = 0.;
+		for(const Dictionary &outfit : outfits)
+			sum += outfit.Get(MASS) + outfit.Get(THRUST) + outfit.Get(COOLING) + outfit.Get(SHIELD_GENERATION);
+		return sum;
+	};
+}
+#endif
+// #endregion benchmarks
+
+
+
+} // benchmark namespace
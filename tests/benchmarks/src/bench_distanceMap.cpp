@@ -0,0 +1,143 @@
+/* bench_distanceMap.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the benchmarked class's header.
+#include "../../../source/DistanceMap.h"
+
+// Include helpers for building a map of systems.
+#include "datanode-factory.h"
+#include "../../../source/Planet.h"
+#include "resource-data.h"
+#include "../../../source/Set.h"
+#include "../../../source/System.h"
+
+// ... and any system includes needed for the benchmark file.
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace { // benchmark namespace
+
+// #region mock data
+
+// The jump drive range that DistanceMap assumes when no ship is given.
+const double JUMP_RANGE = 100.;
+
+// The position and hyperspace links of a system.
+struct MapEntry {
+	std::string name;
+	double x;
+	double y;
+	std::vector<std::string> links;
+};
+
+// Create the systems, with nothing in them but their positions and links.
+// Loading the full system definitions would pull in the rest of the game data.
+void BuildMap(Set<System> &systems, const std::vector<MapEntry> &entries)
+{
+	Set<Planet> planets;
+	for(const MapEntry &entry : entries)
+		systems.Get(entry.name)->Load(AsDataNode("system `" + entry.name + "`\n\tpos "
+			+ std::to_string(entry.x) + " " + std::to_string(entry.y)), planets);
+	for(const MapEntry &entry : entries)
+		for(const std::string &link : entry.links)
+			systems.Get(entry.name)->Link(systems.Get(link));
+	for(const auto &it : systems)
+		systems.Get(it.first)->UpdateSystem(systems, std::set<double>{JUMP_RANGE});
+}
+
+// A square grid of systems, each linked to the ones beside it. The diagonal
+// neighbors can only be reached with a jump drive.
+std::vector<MapEntry> SyntheticMap(int size)
+{
+	std::vector<MapEntry> entries;
+	for(int y = 0; y < size; ++y)
+		for(int x = 0; x < size; ++x)
+		{
+			entries.push_back(MapEntry{"Grid " + std::to_string(x) + " " + std::to_string(y), 70. * x, 70. * y, {}});
+			if(x)
+				entries.back().links.push_back("Grid " + std::to_string(x - 1) + " " + std::to_string(y));
+			if(y)
+				entries.back().links.push_back("Grid " + std::to_string(x) + " " + std::to_string(y - 1));
+		}
+	return entries;
+}
+
+// The map of the game's own galaxy.
+std::vector<MapEntry> ShippedMap()
+{
+	std::vector<MapEntry> entries;
+	for(const DataNode &node : LoadResource("data/map systems.txt"))
+	{
+		if(node.Token(0) != "system" || node.Size() < 2)
+			continue;
+		entries.push_back(MapEntry{node.Token(1), 0., 0., {}});
+		for(const DataNode &child : node)
+		{
+			if(child.Token(0) == "pos" && child.Size() >= 3)
+			{
+				entries.back().x = child.Value(1);
+				entries.back().y = child.Value(2);
+			}
+			else if(child.Token(0) == "link" && child.Size() >= 2)
+				entries.back().links.push_back(child.Token(1));
+		}
+	}
+	return entries;
+}
+
+// #endregion mock data
+
+
+
+// #region benchmarks
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE( "Benchmark DistanceMap construction", "[benchmark][distanceMap]" ) {
+	Set<System> grid;
+	BuildMap(grid, SyntheticMap(40));
+	const System *corner = grid.Get("Grid 0 0");
+	REQUIRE( DistanceMap(corner).Days(grid.Get("Grid 39 39")) == 78 );
+
+	BENCHMARK( "A 40 by 40 grid, by hyperdrive" ) {
+		return DistanceMap(corner).Systems().size();
+	};
+	BENCHMARK( "A 40 by 40 grid, by jump drive" ) {
+		return DistanceMap(corner, WormholeStrategy::NONE, true).Systems().size();
+	};
+
+	Set<System> galaxy;
+	BuildMap(galaxy, ShippedMap());
+	const System *sol = galaxy.Get("Sol");
+	REQUIRE( DistanceMap(sol).Systems().size() > 1 );
+
+	BENCHMARK( "The shipped map from Sol, by hyperdrive" ) {
+		return DistanceMap(sol).Systems().size();
+	};
+	BENCHMARK( "The shipped map from Sol, by jump drive" ) {
+		return DistanceMap(sol, WormholeStrategy::NONE, true).Systems().size();
+	};
+	BENCHMARK( "The shipped map from Sol, within 5 jumps" ) {
+		return DistanceMap(sol, -1, 5).Systems().size();
+	};
+}
+#endif
+// #endregion benchmarks
+
+
+
+} // benchmark namespace
@@ -0,0 +1,30 @@
+/* bench_main.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#define CATCH_CONFIG_RUNNER
+#include "es-test.hpp"
+
+#include "../../../source/Random.h"
+
+int main(int argc, const char *const argv[])
+{
+	// Use the same random numbers in every run, so that the synthetic inputs
+	// are the same each time and the results can be compared between runs.
+	Random::Seed(0);
+
+	// Run the benchmarks.
+	return Catch::Session().run(argc, argv);
+}
+// Add nothing else to this file (unless you like long recompilation times)!
@@ -0,0 +1,113 @@
+/* bench_mask.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the benchmarked class's header.
+#include "../../../source/Mask.h"
+
+// Include helpers for creating the image to trace.
+#include "../../../source/Angle.h"
+#include "../../../source/ImageBuffer.h"
+#include "resource-data.h"
+
+// ... and any system includes needed for the benchmark file.
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace { // benchmark namespace
+
+// #region mock data
+
+// Ship sprites of several sizes, from a fighter to the largest warship.
+const std::vector<std::string> SHIPPED_SPRITES = {
+	"images/ship/sparrow.png",
+	"images/ship/bactrian.png",
+	"images/ship/leviathan.png",
+};
+
+// Draw a ring with a hole in it, so that the mask has nested outlines.
+void DrawRing(ImageBuffer &image, int size)
+{
+	image.Allocate(size, size);
+	double center = .5 * size;
+	for(int y = 0; y < size; ++y)
+	{
+		uint32_t *row = image.Begin(y);
+		for(int x = 0; x < size; ++x)
+		{
+			double distance = std::sqrt((x - center) * (x - center) + (y - center) * (y - center));
+			row[x] = (distance < .45 * size && distance > .2 * size) ? 0xFFFFFFFF : 0;
+		}
+	}
+}
+
+// Fire 360 projectiles at the mask from all around it, one degree apart, with
+// the mask rotated a little differently for each one. Only some of them hit.
+double FireAround(const Mask &mask)
+{
+	double sum = 0.;
+	double range = mask.Radius() + 20.;
+	for(int i = 0; i < 360; ++i)
+	{
+		Angle angle(static_cast<double>(i));
+		Point from = angle.Unit() * range + Point(i % 7 - 3., i % 5 - 2.) * 4.;
+		sum += mask.Collide(from, angle.Unit() * -30., Angle(7. * i));
+	}
+	return sum;
+}
+
+// #endregion mock data
+
+
+
+// #region benchmarks
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE( "Benchmark Mask", "[benchmark][mask]" ) {
+	ImageBuffer ring;
+	DrawRing(ring, 200);
+	Mask synthetic;
+	synthetic.Create(ring);
+	REQUIRE( synthetic.IsLoaded() );
+
+	BENCHMARK( "Create a synthetic ring" ) {
+		Mask mask;
+		mask.Create(ring);
+		return mask.Radius();
+	};
+	BENCHMARK( "Collide with a synthetic ring" ) {
+		return FireAround(synthetic);
+	};
+
+	for(const std::string &path : SHIPPED_SPRITES)
+	{
+		ImageBuffer image;
+		REQUIRE( image.Read(ResourcePath(path)) );
+		Mask mask;
+		mask.Create(image);
+		REQUIRE( mask.IsLoaded() );
+		BENCHMARK( "Collide with " + path ) {
+			return FireAround(mask);
+		};
+	}
+}
+#endif
+// #endregion benchmarks
+
+
+
+} // benchmark namespace
@@ -0,0 +1,143 @@
+/* bench_projectile.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the benchmarked class's header.
+#include "../../../source/Projectile.h"
+
+// Include helpers for creating weapons, both made up and from the game's data.
+#include "datanode-factory.h"
+#include "resource-data.h"
+
+// Include the classes needed to fire and move projectiles.
+#include "../../../source/Angle.h"
+#include "../../../source/Point.h"
+#include "../../../source/Visual.h"
+#include "../../../source/Weapon.h"
+
+// ... and any system includes needed for the benchmark file.
+#include <list>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace { // benchmark namespace
+
+// #region mock data
+
+// The projectiles live much longer than the benchmark runs, so that none of
+// them are removed while it is measured.
+const std::string LIFETIME = "\tlifetime 1000000000\n";
+
+// Only the attributes that change how a projectile moves are read from the
+// game's data. Effects and submunitions would need the rest of the game data.
+const std::set<std::string> MOVEMENT_ATTRIBUTES = {
+	"velocity", "random velocity", "acceleration", "drag", "turn", "homing",
+	"infrared tracking", "optical tracking", "radar tracking",
+};
+
+Weapon MakeWeapon(const std::string &attributes)
+{
+	Weapon weapon;
+	weapon.LoadWeapon(AsDataNode("weapon\n" + LIFETIME + attributes));
+	return weapon;
+}
+
+// Fire projectiles in all directions, as submunitions of stationary explosions,
+// using each of the given weapons in turn.
+std::vector<Projectile> Fire(const std::list<Weapon> &weapons, int count)
+{
+	std::vector<Projectile> projectiles;
+	projectiles.reserve(count);
+	auto it = weapons.begin();
+	for(int i = 0; i < count; ++i)
+	{
+		Projectile explosion(Point((i * 173) % 8000 - 4000, (i * 389) % 6000 - 3000), &*it);
+		projectiles.emplace_back(explosion, Point(), Angle(static_cast<double>((i * 37) % 360)), &*it);
+		if(++it == weapons.end())
+			it = weapons.begin();
+	}
+	return projectiles;
+}
+
+// The movement of every weapon in the game's data.
+std::list<Weapon> ShippedWeapons()
+{
+	std::list<Weapon> result;
+	for(const DataNode &node : LoadResource("data/human/weapons.txt"))
+	{
+		if(node.Token(0) != "outfit")
+			continue;
+		for(const DataNode &child : node)
+		{
+			if(child.Token(0) != "weapon")
+				continue;
+			std::string attributes;
+			for(const DataNode &grand : child)
+				if(grand.Size() >= 2 && MOVEMENT_ATTRIBUTES.count(grand.Token(0)))
+					attributes += "\t\"" + grand.Token(0) + "\" " + grand.Token(1) + "\n";
+			result.push_back(MakeWeapon(attributes));
+		}
+	}
+	return result;
+}
+
+double MoveAll(std::vector<Projectile> &projectiles)
+{
+	std::vector<Visual> visuals;
+	std::vector<Projectile> submunitions;
+	double sum = 0.;
+	for(Projectile &projectile : projectiles)
+	{
+		projectile.Move(visuals, submunitions);
+		sum += projectile.Position().X();
+	}
+	return sum;
+}
+
+// #endregion mock data
+
+
+
+// #region benchmarks
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE( "Benchmark Projectile::Move", "[benchmark][projectile]" ) {
+	// Weapons that fly in a straight line, like most guns, and ones that
+	// accelerate, like most rockets.
+	const std::list<Weapon> coasting = {MakeWeapon("\tvelocity 10\n")};
+	const std::list<Weapon> accelerating = {MakeWeapon("\tvelocity 2\n\tacceleration 1\n\tdrag .1\n")};
+	const std::list<Weapon> shipped = ShippedWeapons();
+	REQUIRE_FALSE( shipped.empty() );
+
+	std::vector<Projectile> projectiles = Fire(coasting, 5000);
+	BENCHMARK( "5000 projectiles that coast" ) {
+		return MoveAll(projectiles);
+	};
+	projectiles = Fire(accelerating, 5000);
+	BENCHMARK( "5000 projectiles that accelerate" ) {
+		return MoveAll(projectiles);
+	};
+	projectiles = Fire(shipped, 5000);
+	BENCHMARK( "5000 projectiles of " + std::to_string(shipped.size()) + " shipped weapons" ) {
+		return MoveAll(projectiles);
+	};
+}
+#endif
+// #endregion benchmarks
+
+
+
+} // benchmark namespace
@@ -0,0 +1,44 @@
+/* resource-data.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "resource-data.h"
+
+#include "../../../../source/DataFile.h"
+#include "../../../../source/Files.h"
+
+#include <string>
+#include <vector>
+
+
+
+std::string ResourcePath(const std::string &path)
+{
+	return "../" + path;
+}
+
+
+
+std::string ReadResource(const std::string &path)
+{
+	return Files::Read(ResourcePath(path));
+}
+
+
+
+std::vector<DataNode> LoadResource(const std::string &path)
+{
+	const DataFile file(ResourcePath(path));
+	return std::vector<DataNode>{std::begin(file), std::end(file)};
+}
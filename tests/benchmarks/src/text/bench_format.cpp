@@ -0,0 +1,89 @@
+/* bench_format.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the benchmarked class's header.
+#include "../../../../source/text/Format.h"
+
+// Include a helper for reading the game's own data.
+#include "resource-data.h"
+
+// ... and any system includes needed for the benchmark file.
+#include <string>
+#include <vector>
+
+namespace { // benchmark namespace
+
+// #region mock data
+
+// Numbers of every magnitude and sign that Format::Number treats differently.
+std::vector<double> SyntheticNumbers(int count)
+{
+	std::vector<double> numbers;
+	double value = .000123;
+	for(int i = 0; i < count; ++i)
+	{
+		numbers.push_back((i % 2 ? -1. : 1.) * value);
+		numbers.push_back(i);
+		value *= 1.37;
+	}
+	return numbers;
+}
+
+// Every number attribute of every outfit, as shown in the outfitter.
+std::vector<double> ShippedNumbers()
+{
+	std::vector<double> numbers;
+	for(const DataNode &node : LoadResource("data/human/outfits.txt"))
+		if(node.Token(0) == "outfit")
+			for(const DataNode &child : node)
+				if(child.Size() >= 2 && child.IsNumber(1))
+					numbers.push_back(child.Value(1));
+	return numbers;
+}
+
+size_t FormatAll(const std::vector<double> &numbers)
+{
+	size_t length = 0;
+	for(double number : numbers)
+		length += Format::Number(number).length();
+	return length;
+}
+
+// #endregion mock data
+
+
+
+// #region benchmarks
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE( "Benchmark Format::Number on many values", "[benchmark][format]" ) {
+	const std::vector<double> synthetic = SyntheticNumbers(100);
+	BENCHMARK( "200 synthetic numbers" ) {
+		return FormatAll(synthetic);
+	};
+
+	const std::vector<double> shipped = ShippedNumbers();
+	REQUIRE_FALSE( shipped.empty() );
+	BENCHMARK( "Every attribute value of the shipped outfits" ) {
+		return FormatAll(shipped);
+	};
+}
+#endif
+// #endregion benchmarks
+
+
+
+} // benchmark namespace
@@ -31,6 +31,14 @@ foreach(test ${INTEGRATION_TESTS_LIST})
 	set(COPY_CONFIG "file(COPY \"${ES_CONFIG}\" DESTINATION \"${TEST_CONFIGS}\")")
 	set(RENAME_CONFIG "file(RENAME \"${TEST_CONFIGS}/config\" \"${TEST_CONFIG}\")")
 
+	# The stress tests measure how long each step takes, which depends on the
+	# machine they run on, so they are labeled separately.
+	if(test MATCHES "^Stress - ")
+		set(TEST_LABEL stress)
+	else()
+		set(TEST_LABEL integration)
+	endif()
+
 	if(UNIX AND NOT APPLE)
 		# Launches the integration tests in release mode: In the background and as fast as possible.
 		set(ADD_TEST
@@ -39,7 +47,7 @@ foreach(test ${INTEGRATION_TESTS_LIST})
 		set(SET_TEST_PROPS
 	"set_tests_properties([==[${test}]==] PROPERTIES
 		WORKING_DIRECTORY \"${CMAKE_CURRENT_SOURCE_DIR}\"
-		LABELS integration ${OFFSCREEN})")
+		LABELS ${TEST_LABEL} ${OFFSCREEN})")
 	endif()
 
 	# Launches the integration tests in debug mode, so that they can be followed.
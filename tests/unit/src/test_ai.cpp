@@ -0,0 +1,273 @@
+/* test_ai.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the tested class's header.
+#include "../../../source/AI.h"
+
+// Include a helper for creating well-formed DataNodes.
+#include "datanode-factory.h"
+
+// Include the classes needed to set up a system full of ships.
+#include "../../../source/Angle.h"
+#include "../../../source/Command.h"
+#include "../../../source/FrameArena.h"
+#include "../../../source/GameData.h"
+#include "../../../source/Government.h"
+#include "../../../source/ImageBuffer.h"
+#include "../../../source/Mask.h"
+#include "../../../source/MaskManager.h"
+#include "../../../source/Outfit.h"
+#include "../../../source/PlayerInfo.h"
+#include "../../../source/Point.h"
+#include "../../../source/Projectile.h"
+#include "../../../source/Ship.h"
+#include "../../../source/Sprite.h"
+#include "../../../source/System.h"
+#include "../../../source/Visual.h"
+#include "../../../source/WorkerPool.h"
+
+// ... and any system includes needed for the test file.
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace { // test namespace
+
+// #region mock data
+
+// Six governments: the first three are each hostile to two of the last three,
+// so every ship has some enemies and some allies.
+const Government *TestGovernment(int index)
+{
+	if(index >= 3)
+		return GameData::Governments().Get("ai test " + std::to_string(index));
+
+	static Government hostile[3];
+	Government &gov = hostile[index];
+	if(gov.GetTrueName().empty())
+		gov.Load(AsDataNode("government \"ai test " + std::to_string(index) + "\"\n"
+			"\t\"attitude toward\"\n"
+			"\t\t\"ai test " + std::to_string(3 + index) + "\" -1\n"
+			"\t\t\"ai test " + std::to_string(3 + (index + 1) % 3) + "\" -1"));
+	return &gov;
+}
+
+// A ship has to have a sprite to be targetable. The image is never drawn, but
+// it is traced to give the ship a collision mask.
+const Sprite *ShipSprite()
+{
+	static Sprite sprite("ai test ship");
+	if(!sprite.Frames())
+	{
+		ImageBuffer image;
+		image.Allocate(42, 42);
+		for(int y = 0; y < 42; ++y)
+		{
+			uint32_t *row = image.Begin(y);
+			for(int x = 0; x < 42; ++x)
+				row[x] = (x && y && x <= 40 && y <= 40) ? 0xFFFFFFFF : 0;
+		}
+		std::vector<Mask> masks(1);
+		masks.front().Create(image);
+		GameData::GetMaskManager().SetMasks(&sprite, std::move(masks));
+		sprite.AddFrames(image, false, true);
+	}
+	return &sprite;
+}
+
+const Outfit &Gun()
+{
+	static Outfit gun;
+	if(!gun.IsDefined())
+		gun.Load(AsDataNode("outfit \"ai test gun\"\n"
+			"\tcategory \"Guns\"\n"
+			"\t\"gun ports\" -1\n"
+			"\tweapon\n"
+			"\t\tvelocity 20\n"
+			"\t\tlifetime 30\n"
+			"\t\treload 10\n"
+			"\t\t\"shield damage\" 10"));
+	return gun;
+}
+
+const Ship &Model()
+{
+	static bool isLoaded = false;
+	static Ship model(AsDataNode("ship \"ai test ship\"\n"
+		"\tattributes\n"
+		"\t\tbunks 1\n"
+		"\t\t\"required crew\" 1\n"
+		"\t\thull 1000\n"
+		"\t\tshields 1000\n"
+		"\t\tmass 100\n"
+		"\t\tdrag 1\n"
+		"\t\tthrust 10\n"
+		"\t\tturn 100\n"
+		"\t\t\"energy capacity\" 1000\n"
+		"\t\t\"energy generation\" 10\n"
+		"\t\t\"heat dissipation\" .5\n"
+		"\tgun 0 -10"));
+	if(!isLoaded)
+	{
+		model.FinishLoading(false);
+		isLoaded = true;
+	}
+	return model;
+}
+
+// A system full of armed ships of all six governments, in fleets of 20 spread
+// out over most of the system, and the AI that controls them.
+class Scene {
+public:
+	explicit Scene(int count)
+		: ai(ships, minables, flotsam, workers, arena)
+	{
+		const System *system = GameData::Systems().Get("ai test system");
+		player.SetSystem(*system);
+		for(int i = 0; i < count; ++i)
+			Add(i, system);
+	}
+
+	void Step()
+	{
+		arena.Reset();
+		Command commands;
+		ai.Step(player, commands);
+	}
+
+
+public:
+	std::list<std::shared_ptr<Ship>> ships;
+	std::list<std::shared_ptr<Minable>> minables;
+	std::list<std::shared_ptr<Flotsam>> flotsam;
+	WorkerPool workers;
+	FrameArena arena;
+	PlayerInfo player;
+	AI ai;
+
+
+private:
+	void Add(int i, const System *system)
+	{
+		auto ship = std::make_shared<Ship>(Model());
+		ship->SetSprite(ShipSprite());
+		ship->AddOutfit(&Gun(), 1);
+		ship->Recharge(true);
+		ship->SetGovernment(TestGovernment(i % 6));
+		ship->SetSystem(system);
+		Point fleet((i / 20 * 7919) % 16000 - 8000, (i / 20 * 104729) % 16000 - 8000);
+		Point offset((i * 389) % 2000 - 1000, (i * 173) % 2000 - 1000);
+		ship->Place(fleet + offset, Point(), Angle(static_cast<double>((i * 37) % 360)));
+		// A ship only becomes targetable once the engine has let it fire.
+		std::vector<Projectile> projectiles;
+		std::vector<Visual> visuals;
+		ship->Fire(projectiles, visuals);
+		ships.push_back(ship);
+	}
+};
+
+// Check that each ship's list of enemies or allies within a range holds the
+// same ships, in the same order, as its full list with the farther ones left
+// out. Returns the number of lists that did not match.
+int CountMismatches(Scene &scene, double range, bool targetEnemies, int &partialLists)
+{
+	int mismatches = 0;
+	for(const auto &ship : scene.ships)
+	{
+		std::vector<Ship *> expected;
+		auto all = scene.ai.GetShipsList(*ship, targetEnemies);
+		for(Ship *other : all)
+			if(ship->Position().Distance(other->Position()) < range)
+				expected.push_back(other);
+
+		auto nearby = scene.ai.GetShipsList(*ship, targetEnemies, range);
+		mismatches += (std::vector<Ship *>(nearby.begin(), nearby.end()) != expected);
+		partialLists += (!nearby.empty() && nearby.size() < all.size());
+	}
+	return mismatches;
+}
+
+// #endregion mock data
+
+
+
+// #region unit tests
+SCENARIO( "Listing the ships near a ship", "[ai]" ) {
+	GIVEN( "a crowded system that the AI has stepped through" ) {
+		Scene scene(300);
+		scene.Step();
+
+		THEN( "limiting the range leaves out only the farther ships, and keeps the rest in order" ) {
+			for(double range : {1000., 4500., 9000.})
+				for(bool targetEnemies : {true, false})
+				{
+					int partialLists = 0;
+					CHECK( CountMismatches(scene, range, targetEnemies, partialLists) == 0 );
+					CHECK( partialLists > 0 );
+				}
+		}
+		WHEN( "some of the ships are gone in the next step" ) {
+			int index = 0;
+			scene.ships.remove_if([&index](const std::shared_ptr<Ship> &) { return !(index++ % 7); });
+			scene.Step();
+
+			THEN( "the lists still match" ) {
+				int partialLists = 0;
+				CHECK( CountMismatches(scene, 4500., true, partialLists) == 0 );
+				CHECK( CountMismatches(scene, 4500., false, partialLists) == 0 );
+				CHECK( partialLists > 0 );
+			}
+		}
+	}
+}
+// #endregion unit tests
+
+// #region benchmarks
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE( "Benchmark finding targets in a crowded system", "[!benchmark][ai]" ) {
+	// 300 ships is about as many as a large battle has. Non-hunting ships with
+	// short range guns search about 4500 units around them.
+	Scene scene(300);
+	scene.Step();
+
+	BENCHMARK( "AI::Step() for 300 ships" ) {
+		scene.Step();
+	};
+	BENCHMARK( "Listing every ship's enemies" ) {
+		scene.arena.Reset();
+		size_t found = 0;
+		for(const auto &ship : scene.ships)
+			found += scene.ai.GetShipsList(*ship, true).size();
+		return found;
+	};
+	BENCHMARK( "Listing every ship's enemies within its search range" ) {
+		scene.arena.Reset();
+		size_t found = 0;
+		for(const auto &ship : scene.ships)
+			found += scene.ai.GetShipsList(*ship, true, 4500.).size();
+		return found;
+	};
+}
+#endif
+// #endregion benchmarks
+
+
+
+} // test namespace
@@ -0,0 +1,407 @@
+/* test_collisionSet.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the tested class's header.
+#include "../../../source/CollisionSet.h"
+
+// Include a helper for creating well-formed DataNodes (to define governments).
+#include "datanode-factory.h"
+
+// Include Body and Point, to have something to put in the set.
+#include "../../../source/Body.h"
+#include "../../../source/Point.h"
+
+// Include what is needed to give bodies a sprite with a collision mask, and a government.
+#include "../../../source/Angle.h"
+#include "../../../source/GameData.h"
+#include "../../../source/Government.h"
+#include "../../../source/ImageBuffer.h"
+#include "../../../source/Mask.h"
+#include "../../../source/MaskManager.h"
+#include "../../../source/Sprite.h"
+
+// ... and any system includes needed for the test file.
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace { // test namespace
+
+// #region mock data
+
+// Bodies without a sprite act as single points.
+std::vector<Body> MakeBodies(int count)
+{
+	std::vector<Body> bodies;
+	bodies.reserve(count);
+	for(int i = 0; i < count; ++i)
+		bodies.emplace_back(nullptr, Point((i * 173) % 2000 - 1000, (i * 389) % 1600 - 800));
+	return bodies;
+}
+
+Point QueryCenter(int i)
+{
+	return Point((i * 97) % 2400 - 1200, (i * 61) % 2000 - 1000);
+}
+
+// A body with a sprite, so that it has a mask that lines can collide with, and
+// optionally a government.
+class ShapedBody : public Body {
+public:
+	ShapedBody(const Sprite *sprite, Point position, Angle facing, const Government *gov)
+		: Body(sprite, position, Point(), facing)
+	{
+		government = gov;
+	}
+};
+
+// A sprite whose only frame is a filled square of the given size, with the mask
+// traced from it registered for it.
+const Sprite *SquareSprite(int size)
+{
+	static std::map<int, Sprite> sprites;
+	auto it = sprites.find(size);
+	if(it != sprites.end())
+		return &it->second;
+
+	Sprite &sprite = sprites.emplace(size, Sprite("square " + std::to_string(size))).first->second;
+	// Leave a transparent border around the square, for the outline to be traced.
+	ImageBuffer image;
+	image.Allocate(size + 2, size + 2);
+	for(int y = 0; y < size + 2; ++y)
+	{
+		uint32_t *row = image.Begin(y);
+		for(int x = 0; x < size + 2; ++x)
+			row[x] = (x && y && x <= size && y <= size) ? 0xFFFFFFFF : 0;
+	}
+	std::vector<Mask> masks(1);
+	masks.front().Create(image);
+	GameData::GetMaskManager().SetMasks(&sprite, std::move(masks));
+	sprite.AddFrames(image, false, true);
+	return &sprite;
+}
+
+// Three governments: the first two are hostile to each other, and the third
+// is hostile to no one.
+const Government *TestGovernment(int index)
+{
+	static Government red;
+	if(red.GetTrueName().empty())
+		red.Load(AsDataNode("government \"collisionSet red\"\n"
+			"\t\"attitude toward\"\n"
+			"\t\t\"collisionSet blue\" -1"));
+	if(!index)
+		return &red;
+	return GameData::Governments().Get(index == 1 ? "collisionSet blue" : "collisionSet green");
+}
+
+std::vector<ShapedBody> MakeShapes(int count)
+{
+	std::vector<ShapedBody> bodies;
+	bodies.reserve(count);
+	for(int i = 0; i < count; ++i)
+		bodies.emplace_back(SquareSprite(i % 2 ? 12 : 30), Point((i * 173) % 2000 - 1000, (i * 389) % 1600 - 800),
+			Angle(static_cast<double>((i * 37) % 360)), TestGovernment(i % 3));
+	return bodies;
+}
+
+// A line segment of up to a few hundred pixels, starting near the query center.
+std::pair<Point, Point> QueryLine(int i)
+{
+	Point from = QueryCenter(i) * .8;
+	return std::make_pair(from, from + Point((i * 53) % 600 - 300, (i * 31) % 600 - 300));
+}
+
+// Bodies of very different sizes, from points to shapes several cells wide, so
+// that an adaptive set has to spread them over more than one level of its grid.
+std::vector<ShapedBody> MakeMixedShapes(int count)
+{
+	const int SIZES[] = {0, 12, 30, 200, 600};
+	std::vector<ShapedBody> bodies;
+	bodies.reserve(count);
+	for(int i = 0; i < count; ++i)
+		bodies.emplace_back(SIZES[i % 5] ? SquareSprite(SIZES[i % 5]) : nullptr,
+			Point((i * 173) % 2000 - 1000, (i * 389) % 1600 - 800),
+			Angle(static_cast<double>((i * 37) % 360)), TestGovernment(i % 3));
+	return bodies;
+}
+
+// The margin that each of those bodies is added with, as if it could move
+// before the set is rebuilt.
+double Margin(int i)
+{
+	return (i % 4 == 1) ? 40. : (i % 4 == 3) ? 300. : 0.;
+}
+
+// What a ring query should find, by checking every body.
+std::vector<Body *> BruteForceRing(std::vector<ShapedBody> &bodies, const Point &center, double inner, double outer)
+{
+	std::vector<Body *> found;
+	for(ShapedBody &body : bodies)
+	{
+		Point offset = center - body.Position();
+		double length = offset.Length();
+		if((length <= outer && length >= inner) || body.GetMask(1).WithinRing(offset, body.Facing(), inner, outer))
+			found.push_back(&body);
+	}
+	return found;
+}
+
+// What a line query should find, by checking every body: how far along the
+// line the first hit is, and every body that is hit there. A line that starts
+// inside several overlapping bodies hits all of them at once.
+std::pair<std::vector<Body *>, double> BruteForceLine(std::vector<ShapedBody> &bodies, int i,
+	const Government *pGov, const Body *target)
+{
+	std::pair<Point, Point> line = QueryLine(i);
+	std::pair<std::vector<Body *>, double> closest(std::vector<Body *>(), 1.);
+	for(ShapedBody &body : bodies)
+	{
+		const Government *iGov = body.GetGovernment();
+		if(&body != target && iGov && pGov && !iGov->IsEnemy(pGov))
+			continue;
+		double range = body.GetMask(1).Collide(line.first - body.Position(), line.second - line.first, body.Facing());
+		if(range < closest.second)
+			closest = std::make_pair(std::vector<Body *>{&body}, range);
+		else if(range == closest.second && range < 1.)
+			closest.first.push_back(&body);
+	}
+	return closest;
+}
+
+bool IsClosestHit(const std::pair<Body *, double> &result, const std::pair<std::vector<Body *>, double> &expected)
+{
+	if(!result.first)
+		return expected.first.empty();
+	return result.second == expected.second
+		&& std::count(expected.first.begin(), expected.first.end(), result.first) == 1;
+}
+
+// The result of a line query: the body hit, if any, and how far along the line it was hit.
+std::pair<Body *, double> LineResult(const CollisionSet &set, int i, const Government *pGov, const Body *target)
+{
+	double closestHit = 1.;
+	std::pair<Point, Point> line = QueryLine(i);
+	Body *hit = set.Line(line.first, line.second, &closestHit, pGov, target);
+	return std::make_pair(hit, closestHit);
+}
+
+// #endregion mock data
+
+
+
+// #region unit tests
+SCENARIO( "Querying a CollisionSet", "[collisionSet]" ) {
+	GIVEN( "a set of bodies" ) {
+		std::vector<Body> bodies = MakeBodies(500);
+		CollisionSet set(64, 16);
+		set.Clear(1);
+		for(Body &body : bodies)
+			set.Add(body);
+		set.Finish();
+
+		THEN( "it contains all of them" ) {
+			CHECK( set.All().size() == bodies.size() );
+		}
+		WHEN( "a circle is queried" ) {
+			Point center(100., -50.);
+			double radius = 300.;
+			std::vector<Body *> result;
+			set.Circle(center, radius, result);
+			THEN( "every body within range is found, once" ) {
+				std::vector<Body *> expected;
+				for(Body &body : bodies)
+					if(body.Position().Distance(center) <= radius)
+						expected.push_back(&body);
+				std::sort(result.begin(), result.end());
+				CHECK( result == expected );
+			}
+			THEN( "the caller's vector matches the set's own result" ) {
+				CHECK( result == set.Circle(center, radius) );
+			}
+		}
+		WHEN( "a ring is queried" ) {
+			Point center(-200., 200.);
+			std::vector<Body *> result;
+			set.Ring(center, 150., 400., result);
+			THEN( "only bodies within the ring are found" ) {
+				std::vector<Body *> expected;
+				for(Body &body : bodies)
+				{
+					double distance = body.Position().Distance(center);
+					if(distance >= 150. && distance <= 400.)
+						expected.push_back(&body);
+				}
+				std::sort(result.begin(), result.end());
+				CHECK( result == expected );
+			}
+		}
+		WHEN( "an adaptive set is refilled after choosing a new cell size" ) {
+			CollisionSet adaptive(64, 16, true);
+			for(int pass = 0; pass < 2; ++pass)
+			{
+				adaptive.Clear(1);
+				for(Body &body : bodies)
+					adaptive.Add(body);
+				adaptive.Finish();
+			}
+			THEN( "its queries find the same bodies as the fixed set" ) {
+				for(int i = 0; i < 50; ++i)
+				{
+					std::vector<Body *> expected = set.Ring(QueryCenter(i), i % 3 ? 0. : 100., 50. + 10. * i);
+					std::vector<Body *> result = adaptive.Ring(QueryCenter(i), i % 3 ? 0. : 100., 50. + 10. * i);
+					std::sort(expected.begin(), expected.end());
+					std::sort(result.begin(), result.end());
+					CHECK( result == expected );
+				}
+			}
+		}
+		WHEN( "the same queries are made from several threads at once" ) {
+			const int QUERIES = 200;
+			std::vector<std::vector<Body *>> serial(QUERIES);
+			for(int i = 0; i < QUERIES; ++i)
+				serial[i] = set.Ring(QueryCenter(i), i % 3 ? 0. : 100., 50. + 2. * i);
+
+			const int THREADS = 4;
+			std::vector<std::vector<std::vector<Body *>>> parallel(THREADS,
+				std::vector<std::vector<Body *>>(QUERIES));
+			std::vector<std::thread> threads;
+			for(int t = 0; t < THREADS; ++t)
+				threads.emplace_back([&set, &parallel, t]() -> void
+				{
+					std::vector<Body *> scratch;
+					for(int i = 0; i < QUERIES; ++i)
+					{
+						set.Ring(QueryCenter(i), i % 3 ? 0. : 100., 50. + 2. * i, scratch);
+						parallel[t][i] = scratch;
+					}
+				});
+			for(std::thread &thread : threads)
+				thread.join();
+
+			THEN( "each thread gets the same results as the serial queries" ) {
+				for(int t = 0; t < THREADS; ++t)
+					CHECK( parallel[t] == serial );
+			}
+		}
+	}
+	GIVEN( "a set of bodies with masks and governments" ) {
+		std::vector<ShapedBody> bodies = MakeShapes(1000);
+		CollisionSet set(64, 16);
+		set.Clear(1);
+		for(ShapedBody &body : bodies)
+			set.Add(body);
+		set.Finish();
+
+		WHEN( "lines are checked from several threads at once" ) {
+			// Check lines as projectiles with no government, as projectiles that
+			// only hit the enemies of the first government, and as those that
+			// also hit their target, which is not an enemy.
+			const int QUERIES = 500;
+			const Government *pGov = TestGovernment(0);
+			const Body *target = &bodies[2];
+			using Results = std::vector<std::pair<Body *, double>>;
+			auto checkLines = [&set, pGov, target](Results &results) -> void
+			{
+				results.clear();
+				for(int i = 0; i < QUERIES; ++i)
+				{
+					results.push_back(LineResult(set, i, nullptr, nullptr));
+					results.push_back(LineResult(set, i, pGov, nullptr));
+					results.push_back(LineResult(set, i, pGov, target));
+				}
+			};
+			Results serial;
+			checkLines(serial);
+
+			const int THREADS = 4;
+			std::vector<Results> parallel(THREADS);
+			std::vector<std::thread> threads;
+			for(int t = 0; t < THREADS; ++t)
+				threads.emplace_back([&checkLines, &parallel, t]() -> void { checkLines(parallel[t]); });
+			for(std::thread &thread : threads)
+				thread.join();
+
+			THEN( "some lines hit, and those with a government only hit its enemies" ) {
+				int hits = 0;
+				int friendlyHits = 0;
+				for(int i = 0; i < QUERIES; ++i)
+				{
+					hits += (serial[3 * i].first != nullptr);
+					friendlyHits += (serial[3 * i + 1].first && serial[3 * i + 1].first->GetGovernment() != TestGovernment(1));
+				}
+				CHECK( hits > QUERIES / 10 );
+				CHECK( friendlyHits == 0 );
+			}
+			THEN( "each thread gets the same results as the serial checks" ) {
+				for(int t = 0; t < THREADS; ++t)
+					CHECK( parallel[t] == serial );
+			}
+		}
+	}
+	GIVEN( "an adaptive set of bodies of many sizes, some of them added with a margin" ) {
+		std::vector<ShapedBody> bodies = MakeMixedShapes(600);
+		CollisionSet set(64, 16, true);
+		// Fill the set twice, so that the second time it uses the cell size
+		// that it picked based on the first.
+		for(int pass = 0; pass < 2; ++pass)
+		{
+			set.Clear(1);
+			for(size_t i = 0; i < bodies.size(); ++i)
+				set.Add(bodies[i], Margin(i));
+			set.Finish();
+		}
+
+		THEN( "circles and rings find the same bodies as checking each body" ) {
+			for(int i = 0; i < 100; ++i)
+			{
+				double inner = i % 3 ? 0. : 100.;
+				double outer = 50. + 10. * i;
+				std::vector<Body *> result = set.Ring(QueryCenter(i), inner, outer);
+				std::sort(result.begin(), result.end());
+				CHECK( result == BruteForceRing(bodies, QueryCenter(i), inner, outer) );
+
+				std::vector<Body *> circle = set.Circle(QueryCenter(i), outer);
+				std::sort(circle.begin(), circle.end());
+				CHECK( circle == BruteForceRing(bodies, QueryCenter(i), 0., outer) );
+			}
+		}
+		THEN( "lines hit the same bodies, at the same distance, as checking each body" ) {
+			const Government *pGov = TestGovernment(0);
+			const Body *target = &bodies[3];
+			int hits = 0;
+			for(int i = 0; i < 300; ++i)
+			{
+				std::pair<Body *, double> result = LineResult(set, i, nullptr, nullptr);
+				hits += (result.first != nullptr);
+				CHECK( IsClosestHit(result, BruteForceLine(bodies, i, nullptr, nullptr)) );
+				CHECK( IsClosestHit(LineResult(set, i, pGov, nullptr), BruteForceLine(bodies, i, pGov, nullptr)) );
+				CHECK( IsClosestHit(LineResult(set, i, pGov, target), BruteForceLine(bodies, i, pGov, target)) );
+			}
+			CHECK( hits > 30 );
+		}
+	}
+}
+// #endregion unit tests
+
+
+
+} // test namespace
@@ -53,6 +53,48 @@ SCENARIO( "A Dictionary instance is being used", "[dictionary]") {
 	}
 }
 
+SCENARIO( "Looking up a Dictionary::Key", "[dictionary]") {
+	GIVEN( "keys created before the dictionary is filled in" ) {
+		const Dictionary::Key foo("test key foo");
+		const Dictionary::Key bar("test key bar");
+		const Dictionary::Key missing("test key missing");
+		Dictionary dict;
+		THEN( "an empty dictionary has no value for them" ) {
+			CHECK( dict.Get(foo) == 0. );
+		}
+		WHEN( "entries are inserted before and after them" ) {
+			dict["test key foo"] = 10.;
+			dict["test key zzz"] = 1.;
+			dict["test key bar"] = 42.;
+			dict["test key aaa"] = 2.;
+			THEN( "the keys find the same values as the strings" ) {
+				CHECK( dict.Get(foo) == 10. );
+				CHECK( dict.Get(bar) == 42. );
+				CHECK( dict.Get(missing) == 0. );
+				CHECK( dict.Get(foo) == dict.Get("test key foo") );
+			}
+			THEN( "modifying an entry is reflected by its key" ) {
+				dict["test key bar"] += 1.;
+				CHECK( dict.Get(bar) == 43. );
+			}
+		}
+	}
+	GIVEN( "a key created after the dictionary is filled in" ) {
+		Dictionary dict;
+		dict["test key late"] = 5.;
+		dict["test key other"] = 6.;
+		const Dictionary::Key late("test key late");
+		THEN( "it still finds the value" ) {
+			CHECK( dict.Get(late) == 5. );
+		}
+		THEN( "it still finds the value after more entries are inserted" ) {
+			dict["test key early"] = 7.;
+			CHECK( dict.Get(late) == 5. );
+			CHECK( dict.Get(Dictionary::Key("test key early")) == 7. );
+		}
+	}
+}
+
 // #region benchmarks
 #ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
 TEST_CASE( "Benchmark Dictionary::Get", "[!benchmark][dictionary]" ) {
@@ -75,6 +117,14 @@ TEST_CASE( "Benchmark Dictionary::Get", "[!benchmark][dictionary]" ) {
 	BENCHMARK( "Dictionary::Get()", i ) {
 		return dict.Get(strings[i % SIZE]);
 	};
+
+	std::vector<Dictionary::Key> keys;
+	for(const std::string &str : strings)
+		keys.emplace_back(str.c_str());
+
+	BENCHMARK( "Dictionary::Get() with a Key", i ) {
+		return dict.Get(keys[i % SIZE]);
+	};
 }
 #endif
 // #endregion benchmarks
@@ -0,0 +1,94 @@
+/* test_frameArena.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the tested class's header.
+#include "../../../source/FrameArena.h"
+
+// ... and any system includes needed for the test file.
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace { // test namespace
+
+// #region mock data
+
+// Fill the arena with a step's worth of temporary lists, and check that they
+// did not overwrite each other.
+bool SimulateStep(FrameArena &arena, int lists)
+{
+	std::vector<FrameVector<std::pair<double, int>>> all;
+	for(int i = 0; i < lists; ++i)
+	{
+		all.emplace_back(FrameAllocator<std::pair<double, int>>(arena));
+		for(int j = 0; j < 100; ++j)
+			all.back().emplace_back(i * .5, j);
+	}
+	for(int i = 0; i < lists; ++i)
+		for(int j = 0; j < 100; ++j)
+			if(all[i][j].first != i * .5 || all[i][j].second != j)
+				return false;
+	return true;
+}
+
+// #endregion mock data
+
+
+
+// #region unit tests
+SCENARIO( "Allocating temporary lists from a FrameArena", "[frameArena]" ) {
+	GIVEN( "an empty arena" ) {
+		FrameArena arena;
+		THEN( "nothing has been allocated" ) {
+			CHECK( arena.Allocations() == 0 );
+			CHECK( arena.HeapAllocations() == 0 );
+		}
+		WHEN( "memory of different alignments is allocated" ) {
+			arena.Allocate(1, 1);
+			void *eight = arena.Allocate(8, 8);
+			arena.Allocate(3, 1);
+			void *sixteen = arena.Allocate(16, 16);
+			THEN( "it is aligned" ) {
+				CHECK( reinterpret_cast<uintptr_t>(eight) % 8 == 0 );
+				CHECK( reinterpret_cast<uintptr_t>(sixteen) % 16 == 0 );
+			}
+			THEN( "only the first allocation uses the heap" ) {
+				CHECK( arena.Allocations() == 4 );
+				CHECK( arena.HeapAllocations() == 1 );
+			}
+		}
+		WHEN( "a step needs more than one block" ) {
+			REQUIRE( SimulateStep(arena, 200) );
+			REQUIRE( arena.HeapAllocations() > 1 );
+			arena.Reset();
+			THEN( "its blocks are replaced by a single one" ) {
+				CHECK( arena.HeapAllocations() == 1 );
+			}
+			THEN( "the same step can be repeated without touching the heap again" ) {
+				arena.Reset();
+				CHECK( SimulateStep(arena, 200) );
+				CHECK( arena.Allocations() > 200 );
+				CHECK( arena.HeapAllocations() == 0 );
+			}
+		}
+	}
+}
+// #endregion unit tests
+
+
+
+} // test namespace
@@ -0,0 +1,217 @@
+/* test_mask.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the tested class's header.
+#include "../../../source/Mask.h"
+
+// Include a helper for creating the image to trace.
+#include "../../../source/ImageBuffer.h"
+
+// ... and any system includes needed for the test file.
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace { // test namespace
+
+// #region mock data
+
+// Draw a ring with a hole in it, and a separate square off to one side, so
+// that the mask has several outlines, one of them nested inside another.
+void DrawShapes(ImageBuffer &image)
+{
+	const int WIDTH = 120;
+	const int HEIGHT = 90;
+	image.Allocate(WIDTH, HEIGHT);
+	for(int y = 0; y < HEIGHT; ++y)
+	{
+		uint32_t *row = image.Begin(y);
+		for(int x = 0; x < WIDTH; ++x)
+		{
+			double distance = std::sqrt((x - 45.) * (x - 45.) + (y - 45.) * (y - 45.));
+			bool ring = distance < 40. && distance > 15.;
+			bool square = x >= 95 && x < 115 && y >= 10 && y < 30;
+			row[x] = (ring || square) ? 0xFFFFFFFF : 0;
+		}
+	}
+}
+
+// The straightforward versions of the mask's queries, which check every edge
+// or vertex of every outline. The mask's own results must match these exactly.
+bool ReferenceContains(const Mask &mask, Point point)
+{
+	int intersections = 0;
+	for(auto &&outline : mask.Outlines())
+	{
+		Point prev = outline.back();
+		for(auto &&next : outline)
+		{
+			if(prev.X() != next.X())
+				if((prev.X() <= point.X()) == (point.X() < next.X()))
+				{
+					double y = prev.Y() + (next.Y() - prev.Y()) *
+						(point.X() - prev.X()) / (next.X() - prev.X());
+					intersections += (y >= point.Y());
+				}
+			prev = next;
+		}
+	}
+	return (intersections & 1);
+}
+
+double ReferenceIntersection(const Mask &mask, Point sA, Point vA)
+{
+	double closest = 1.;
+	for(auto &&outline : mask.Outlines())
+	{
+		Point prev = outline.back();
+		for(auto &&next : outline)
+		{
+			Point vB = next - prev;
+			double cross = vB.Cross(vA);
+			if(cross > 0.)
+			{
+				Point vS = prev - sA;
+				double uB = vA.Cross(vS);
+				double uA = vB.Cross(vS);
+				if((uB >= 0.) & (uB < cross) & (uA >= 0.))
+					closest = std::min(closest, uA / cross);
+			}
+			prev = next;
+		}
+	}
+	return closest;
+}
+
+bool ReferenceWithinRing(const Mask &mask, Point point, double inner, double outer)
+{
+	for(auto &&outline : mask.Outlines())
+		for(auto &&p : outline)
+		{
+			double pSquared = p.DistanceSquared(point);
+			if(pSquared < outer * outer && pSquared > inner * inner)
+				return true;
+		}
+	return false;
+}
+
+double ReferenceRange(const Mask &mask, Point point)
+{
+	if(ReferenceContains(mask, point))
+		return 0.;
+	double range = std::numeric_limits<double>::infinity();
+	for(auto &&outline : mask.Outlines())
+		for(auto &&p : outline)
+			range = std::min(range, p.Distance(point));
+	return range;
+}
+
+// A spread of points in and around the mask.
+Point QueryPoint(int i, double scale)
+{
+	return Point(((i * 7919) % 1400) / 10. - 70., ((i * 104729) % 1100) / 10. - 55.) * scale;
+}
+
+// #endregion mock data
+
+
+
+// #region unit tests
+SCENARIO( "Querying a Mask", "[mask]" ) {
+	GIVEN( "a mask traced from an image" ) {
+		ImageBuffer image;
+		DrawShapes(image);
+		Mask traced;
+		traced.Create(image);
+		REQUIRE( traced.IsLoaded() );
+		REQUIRE( traced.Outlines().size() == 3 );
+
+		// Facing zero leaves the query points unchanged.
+		Angle facing;
+		const int QUERIES = 2000;
+		const std::vector<double> SCALES = {1., .4, 2.5};
+		WHEN( "checking whether points are contained in it" ) {
+			THEN( "every edge is taken into account" ) {
+				for(double scale : SCALES)
+				{
+					Mask mask = traced * scale;
+					for(int i = 0; i < QUERIES; ++i)
+					{
+						Point point = QueryPoint(i, scale);
+						bool expected = point.Length() <= mask.Radius() && ReferenceContains(mask, point);
+						CHECK( mask.Contains(point, facing) == expected );
+					}
+				}
+			}
+		}
+		WHEN( "checking how close points are to it" ) {
+			THEN( "the distance to the closest vertex is found" ) {
+				for(double scale : SCALES)
+				{
+					Mask mask = traced * scale;
+					for(int i = 0; i < QUERIES; ++i)
+					{
+						Point point = QueryPoint(i, scale);
+						CHECK( mask.Range(point, facing) == ReferenceRange(mask, point) );
+					}
+				}
+			}
+		}
+		WHEN( "checking whether it touches a ring" ) {
+			THEN( "every vertex is taken into account" ) {
+				for(double scale : SCALES)
+				{
+					Mask mask = traced * scale;
+					for(int i = 0; i < QUERIES; ++i)
+					{
+						Point point = QueryPoint(i, scale);
+						double inner = (i % 50) * scale;
+						double outer = inner + (i % 7 + 1) * 4. * scale;
+						bool expected = inner <= point.Length() + mask.Radius()
+							&& outer >= point.Length() - mask.Radius()
+							&& ReferenceWithinRing(mask, point, inner, outer);
+						CHECK( mask.WithinRing(point, facing, inner, outer) == expected );
+					}
+				}
+			}
+		}
+		WHEN( "colliding line segments with it" ) {
+			THEN( "the closest entry point is found" ) {
+				for(double scale : SCALES)
+				{
+					Mask mask = traced * scale;
+					for(int i = 0; i < QUERIES; ++i)
+					{
+						Point sA = QueryPoint(i, scale);
+						Point vA = QueryPoint(i + QUERIES, scale) * (i % 3 + .5) - sA;
+						double expected = ReferenceIntersection(mask, sA, vA);
+						if(sA.Length() <= mask.Radius() && ReferenceContains(mask, sA))
+							expected = 0.;
+						CHECK( mask.Collide(sA, vA, facing) == expected );
+					}
+				}
+			}
+		}
+	}
+}
+// #endregion unit tests
+
+
+
+} // test namespace
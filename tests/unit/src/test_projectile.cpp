@@ -0,0 +1,120 @@
+/* test_projectile.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the tested class's header.
+#include "../../../source/Projectile.h"
+
+// Include a helper for creating well-formed DataNodes.
+#include "datanode-factory.h"
+
+// Include the classes needed to fire and move projectiles.
+#include "../../../source/Angle.h"
+#include "../../../source/Point.h"
+#include "../../../source/Visual.h"
+#include "../../../source/Weapon.h"
+
+// ... and any system includes needed for the test file.
+#include <string>
+#include <vector>
+
+namespace { // test namespace
+
+// #region mock data
+
+const int LIFETIME = 20;
+
+Weapon MakeWeapon(const std::string &extra)
+{
+	Weapon weapon;
+	weapon.LoadWeapon(AsDataNode("weapon\n"
+		"\tvelocity 7.5\n"
+		"\tlifetime " + std::to_string(LIFETIME) + "\n"
+		+ extra));
+	return weapon;
+}
+
+// A weapon that flies in a straight line takes the short path through Move().
+// A split range makes a weapon take the full path, but without a target the
+// split range is never checked, so the projectile flies just the same.
+const Weapon &Coasting()
+{
+	static const Weapon weapon = MakeWeapon("");
+	return weapon;
+}
+
+const Weapon &Steering()
+{
+	static const Weapon weapon = MakeWeapon("\t\"split range\" 50\n");
+	return weapon;
+}
+
+// Fire a projectile without a ship, as a submunition of a stationary explosion.
+Projectile Fire(const Weapon &weapon, const Angle &facing)
+{
+	Projectile explosion(Point(100., -200.), &weapon);
+	return Projectile(explosion, Point(3., 4.), facing, &weapon);
+}
+
+// #endregion mock data
+
+
+
+// #region unit tests
+SCENARIO( "Moving a projectile that coasts", "[projectile]" ) {
+	GIVEN( "two projectiles fired the same way, one of which takes the full path" ) {
+		std::vector<Visual> visuals;
+		std::vector<Projectile> projectiles;
+		const Angle facing(37.);
+		Projectile coasting = Fire(Coasting(), facing);
+		Projectile steering = Fire(Steering(), facing);
+		REQUIRE( coasting.Velocity().Length() > 0. );
+
+		WHEN( "they are moved for several frames" ) {
+			for(int i = 1; i < LIFETIME; ++i)
+			{
+				coasting.Move(visuals, projectiles);
+				steering.Move(visuals, projectiles);
+				REQUIRE( coasting.Position().X() == steering.Position().X() );
+				REQUIRE( coasting.Position().Y() == steering.Position().Y() );
+				REQUIRE( coasting.Velocity().X() == steering.Velocity().X() );
+				REQUIRE( coasting.Velocity().Y() == steering.Velocity().Y() );
+				REQUIRE( coasting.Facing().Degrees() == steering.Facing().Degrees() );
+				REQUIRE( coasting.DistanceTraveled() == steering.DistanceTraveled() );
+			}
+			THEN( "they have flown the same distance in a straight line" ) {
+				CHECK( coasting.DistanceTraveled() == Approx(7.5 * (LIFETIME - 1)) );
+				CHECK_FALSE( coasting.ShouldBeRemoved() );
+				CHECK_FALSE( steering.ShouldBeRemoved() );
+			}
+			AND_WHEN( "their lifetime runs out" ) {
+				coasting.Move(visuals, projectiles);
+				steering.Move(visuals, projectiles);
+				THEN( "both of them are removed" ) {
+					CHECK( coasting.ShouldBeRemoved() );
+					CHECK( steering.ShouldBeRemoved() );
+					CHECK( visuals.empty() );
+					CHECK( projectiles.empty() );
+				}
+			}
+		}
+	}
+}
+// #endregion unit tests
+
+
+
+} // test namespace
@@ -19,6 +19,9 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "../../../source/Random.h"
 
 // ... and any system includes needed for the test file.
+#include <cstdint>
+#include <thread>
+#include <vector>
 
 namespace { // test namespace
 
@@ -31,6 +34,62 @@ namespace { // test namespace
 TEST_CASE( "Random::Int", "[random][int]") {
 	REQUIRE( Random::Int(1) == 0 );
 }
+SCENARIO( "Drawing random numbers in several threads", "[random]" ) {
+	GIVEN( "a seeded generator" ) {
+		Random::Seed(1234);
+		std::vector<uint32_t> expected;
+		for(int i = 0; i < 10; ++i)
+			expected.push_back(Random::Int());
+		Random::Seed(1234);
+
+		WHEN( "another thread seeds and draws from its generator in between" ) {
+			std::vector<uint32_t> drawn;
+			for(int i = 0; i < 5; ++i)
+				drawn.push_back(Random::Int());
+			std::thread other([]() -> void
+			{
+				Random::ThreadGuard guard;
+				Random::Seed(1);
+				for(int i = 0; i < 100; ++i)
+					Random::Int();
+			});
+			other.join();
+			for(int i = 0; i < 5; ++i)
+				drawn.push_back(Random::Int());
+
+			THEN( "this thread's numbers are not affected" ) {
+				CHECK( drawn == expected );
+			}
+		}
+	}
+}
+SCENARIO( "Starting a thread after another one has exited", "[random]" ) {
+	GIVEN( "a thread that has drawn random numbers and exited" ) {
+		uint32_t first = 0;
+		std::thread thread([&first]() -> void
+		{
+			Random::ThreadGuard guard;
+			first = Random::Int();
+			for(int i = 0; i < 100; ++i)
+				Random::Int();
+		});
+		thread.join();
+
+		WHEN( "a new thread draws its first number" ) {
+			uint32_t next = 0;
+			std::thread other([&next]() -> void
+			{
+				Random::ThreadGuard guard;
+				next = Random::Int();
+			});
+			other.join();
+
+			THEN( "it starts from a new generator, even if it reuses the old thread's ID" ) {
+				CHECK( next == first );
+			}
+		}
+	}
+}
 // Test code goes here. Preferably, use scenario-driven language making use of the SCENARIO, GIVEN,
 // WHEN, and THEN macros. (There will be cases where the more traditional TEST_CASE and SECTION macros
 // are better suited to declaration of the public API.)
@@ -0,0 +1,174 @@
+/* test_replay.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the tested class's header.
+#include "../../../source/Replay.h"
+
+// Include the helpers needed to write and read back the files.
+#include "../../../source/Files.h"
+#include "../../../source/Preferences.h"
+
+// ... and any system includes needed for the test file.
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace { // test namespace
+
+// #region mock data
+
+const std::string SAVE_PATH = "replay test save.txt";
+const std::string REPLAY_PATH = "replay test.txt";
+const std::string SAVE = "pilot Test Pilot\n"
+	"system Sol\n"
+	"ship Shuttle\n"
+	"\tname \"Test Ship\"\n";
+
+// Record a few steps that use every kind of input there is.
+Replay Record()
+{
+	Files::Write(SAVE_PATH, SAVE);
+	Replay replay;
+	replay.Begin(SAVE_PATH, 0xfedcba9876543210ull, 42);
+	std::remove(SAVE_PATH.c_str());
+
+	std::vector<Replay::Step> &steps = replay.Steps();
+	steps.resize(3);
+	steps[0].checksum = 0x8000000000000001ull;
+	steps[0].commands = Command::FORWARD;
+	steps[0].commands.Set(Command::PRIMARY);
+	steps[0].commands.SetTurn(-.25);
+
+	steps[1].checksum = 1;
+	steps[1].hasClick = true;
+	steps[1].isRightClick = true;
+	steps[1].isRadarClick = true;
+	steps[1].clickPoint = Point(-100.5, 20.);
+	steps[1].clickBox = Rectangle(Point(-100.5, 20.), Point(2., 4.));
+	steps[1].uiClickBox = Rectangle(Point(5., 6.), Point(7., 8.));
+	steps[1].group = 3;
+	steps[1].hasShift = true;
+	steps[1].hasControl = true;
+
+	steps[2].checksum = 2;
+	steps[2].isMouseTurning = true;
+	steps[2].isMouseFiring = true;
+	steps[2].mousePosition = Point(300., -400.);
+	return replay;
+}
+
+// Save the given recording and load it back.
+Replay SaveAndLoad(const Replay &replay, bool &isLoaded)
+{
+	replay.Save(REPLAY_PATH);
+	Replay loaded;
+	isLoaded = loaded.Load(REPLAY_PATH);
+	std::remove(REPLAY_PATH.c_str());
+	return loaded;
+}
+
+bool SameRectangle(const Rectangle &a, const Rectangle &b)
+{
+	return a.Center().X() == b.Center().X() && a.Center().Y() == b.Center().Y()
+		&& a.Dimensions().X() == b.Dimensions().X() && a.Dimensions().Y() == b.Dimensions().Y();
+}
+
+// #endregion mock data
+
+
+
+// #region unit tests
+SCENARIO( "Saving and loading a recording", "[replay]" ) {
+	GIVEN( "a recording of a few steps" ) {
+		Preferences::Set("Turrets focus fire", true);
+		Preferences::Set("Escorts expend ammo", false);
+		const std::string autoFire = Preferences::AutoFireSetting();
+		Replay replay = Record();
+
+		WHEN( "it is saved and loaded back" ) {
+			bool isLoaded = false;
+			Replay loaded = SaveAndLoad(replay, isLoaded);
+			REQUIRE( isLoaded );
+
+			THEN( "the seed and the first step are the same" ) {
+				CHECK( loaded.Seed() == 0xfedcba9876543210ull );
+				CHECK( loaded.FirstStep() == 42 );
+			}
+			THEN( "the input of every step is the same" ) {
+				const std::vector<Replay::Step> &steps = loaded.Steps();
+				REQUIRE( steps.size() == 3 );
+				CHECK( steps[0].checksum == 0x8000000000000001ull );
+				CHECK( steps[0].commands.State() == replay.Steps()[0].commands.State() );
+				CHECK( steps[0].commands.Turn() == -.25 );
+				CHECK_FALSE( steps[0].hasClick );
+				CHECK( steps[0].group == -1 );
+				CHECK_FALSE( steps[0].isMouseTurning );
+
+				CHECK( steps[1].checksum == 1 );
+				CHECK_FALSE( steps[1].commands );
+				CHECK( steps[1].hasClick );
+				CHECK( steps[1].isRightClick );
+				CHECK( steps[1].isRadarClick );
+				CHECK( steps[1].clickPoint.X() == -100.5 );
+				CHECK( steps[1].clickPoint.Y() == 20. );
+				CHECK( SameRectangle(steps[1].clickBox, replay.Steps()[1].clickBox) );
+				CHECK( SameRectangle(steps[1].uiClickBox, replay.Steps()[1].uiClickBox) );
+				CHECK( steps[1].group == 3 );
+				CHECK( steps[1].hasShift );
+				CHECK( steps[1].hasControl );
+
+				CHECK( steps[2].checksum == 2 );
+				CHECK( steps[2].isMouseTurning );
+				CHECK( steps[2].isMouseFiring );
+				CHECK( steps[2].mousePosition.X() == 300. );
+				CHECK( steps[2].mousePosition.Y() == -400. );
+			}
+			THEN( "the saved game is the same" ) {
+				loaded.WriteSave(SAVE_PATH);
+				std::string save = Files::Read(SAVE_PATH);
+				std::remove(SAVE_PATH.c_str());
+				CHECK( save == SAVE );
+			}
+			THEN( "the preferences can be changed back to what they were" ) {
+				Preferences::Set("Turrets focus fire", false);
+				Preferences::Set("Escorts expend ammo", true);
+				Preferences::ToggleAutoFire();
+				REQUIRE( Preferences::AutoFireSetting() != autoFire );
+
+				loaded.ApplyPreferences();
+				CHECK( Preferences::Has("Turrets focus fire") );
+				CHECK_FALSE( Preferences::Has("Escorts expend ammo") );
+				CHECK( Preferences::AutoFireSetting() == autoFire );
+			}
+		}
+	}
+	GIVEN( "a file that is not a recording" ) {
+		Files::Write(REPLAY_PATH, SAVE);
+		Replay replay;
+		bool isLoaded = replay.Load(REPLAY_PATH);
+		std::remove(REPLAY_PATH.c_str());
+		THEN( "it is not loaded" ) {
+			CHECK_FALSE( isLoaded );
+		}
+	}
+}
+// #endregion unit tests
+
+
+
+} // test namespace
@@ -0,0 +1,146 @@
+/* test_shipRegistry.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the tested class's header.
+#include "../../../source/ShipRegistry.h"
+
+// Include Ship, to have something to register.
+#include "../../../source/Ship.h"
+
+// ... and any system includes needed for the test file.
+#include <list>
+#include <memory>
+#include <vector>
+
+namespace { // test namespace
+
+// #region mock data
+
+std::list<std::shared_ptr<Ship>> MakeShips(int count)
+{
+	std::list<std::shared_ptr<Ship>> ships;
+	for(int i = 0; i < count; ++i)
+		ships.push_back(std::make_shared<Ship>());
+	return ships;
+}
+
+std::vector<Ship *> Pointers(const std::list<std::shared_ptr<Ship>> &ships)
+{
+	std::vector<Ship *> result;
+	for(const std::shared_ptr<Ship> &ship : ships)
+		result.push_back(ship.get());
+	return result;
+}
+
+// #endregion mock data
+
+
+
+// #region unit tests
+SCENARIO( "Keeping a ShipRegistry up to date", "[shipRegistry]" ) {
+	GIVEN( "a registry of a list of ships" ) {
+		std::list<std::shared_ptr<Ship>> ships = MakeShips(5);
+		ShipRegistry registry;
+		registry.Update(ships);
+
+		THEN( "the ships are listed in the same order" ) {
+			CHECK( registry.Ships() == Pointers(ships) );
+		}
+		THEN( "each ship's handle refers to it" ) {
+			for(const std::shared_ptr<Ship> &ship : ships)
+				CHECK( registry.Get(ship->RegistryHandle()) == ship.get() );
+		}
+		WHEN( "the registry is updated again" ) {
+			std::vector<ShipRegistry::Handle> handles;
+			for(const std::shared_ptr<Ship> &ship : ships)
+				handles.push_back(ship->RegistryHandle());
+			registry.Update(ships);
+			THEN( "the ships keep their handles" ) {
+				auto it = ships.begin();
+				for(const ShipRegistry::Handle &handle : handles)
+					CHECK( (*it++)->RegistryHandle() == handle );
+			}
+		}
+		WHEN( "ships leave the list and others join it" ) {
+			ShipRegistry::Handle removed = ships.front()->RegistryHandle();
+			ships.pop_front();
+			std::list<std::shared_ptr<Ship>> newShips = MakeShips(3);
+			ships.splice(ships.begin(), newShips);
+			registry.Update(ships);
+			THEN( "handles to the removed ship no longer resolve" ) {
+				CHECK_FALSE( registry.Get(removed) );
+			}
+			THEN( "the ships are listed in their new order" ) {
+				CHECK( registry.Ships() == Pointers(ships) );
+				for(const std::shared_ptr<Ship> &ship : ships)
+					CHECK( registry.Get(ship->RegistryHandle()) == ship.get() );
+			}
+		}
+		WHEN( "a registered ship is copied" ) {
+			Ship copy = *ships.front();
+			THEN( "the copy does not share its handle" ) {
+				CHECK( copy.RegistryHandle() == ShipRegistry::Handle() );
+				CHECK_FALSE( registry.Get(copy.RegistryHandle()) );
+			}
+		}
+		WHEN( "the registry is cleared" ) {
+			std::vector<ShipRegistry::Handle> handles;
+			for(const std::shared_ptr<Ship> &ship : ships)
+				handles.push_back(ship->RegistryHandle());
+			registry.Clear();
+			registry.Update(MakeShips(5));
+			THEN( "no old handle resolves, even though the slots are reused" ) {
+				CHECK( registry.Ships().size() == 5 );
+				for(const ShipRegistry::Handle &handle : handles)
+					CHECK_FALSE( registry.Get(handle) );
+			}
+		}
+	}
+}
+
+SCENARIO( "Looking up a ship's target by handle", "[shipRegistry]" ) {
+	GIVEN( "a ship targeting a registered ship" ) {
+		std::list<std::shared_ptr<Ship>> ships = MakeShips(2);
+		ShipRegistry registry;
+		registry.Update(ships);
+		std::shared_ptr<Ship> hunter = ships.front();
+		std::shared_ptr<Ship> target = ships.back();
+		hunter->SetTargetShip(target);
+
+		THEN( "the target's handle resolves to it" ) {
+			CHECK( registry.Get(hunter->TargetShipHandle()) == target.get() );
+		}
+		WHEN( "the target is cleared" ) {
+			hunter->SetTargetShip(nullptr);
+			THEN( "so is its handle" ) {
+				CHECK_FALSE( registry.Get(hunter->TargetShipHandle()) );
+			}
+		}
+		WHEN( "the target leaves the list" ) {
+			ships.pop_back();
+			registry.Update(ships);
+			THEN( "its handle no longer resolves" ) {
+				CHECK_FALSE( registry.Get(hunter->TargetShipHandle()) );
+			}
+		}
+	}
+}
+// #endregion unit tests
+
+
+
+} // test namespace
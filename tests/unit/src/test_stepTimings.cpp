@@ -0,0 +1,166 @@
+/* test_stepTimings.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the tested class's header.
+#include "../../../source/StepTimings.h"
+
+// Include the helpers needed to read back a written file.
+#include "../../../source/Files.h"
+
+// ... and any system includes needed for the test file.
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace { // test namespace
+
+// #region mock data
+
+const std::vector<std::string> PHASES = {"first", "second"};
+
+// Do some work that the compiler cannot remove, so that there is something to time.
+double Work(int count)
+{
+	volatile double sum = 0.;
+	for(int i = 0; i < count; ++i)
+		sum = sum + i * .5;
+	return sum;
+}
+
+// Time a number of steps, with the second phase doing more work than the first.
+void TimeSteps(StepTimings &timings, int steps)
+{
+	for(int i = 0; i < steps; ++i)
+	{
+		StepTimings::Timer timer(timings);
+		timer.Start(0);
+		Work(100);
+		timer.Start(1);
+		Work(100000);
+		timer.Stop();
+		timings.EndStep();
+	}
+}
+
+// Record steps with the given times, the second phase always taking twice as
+// long as the first.
+void RecordSteps(StepTimings &timings, const std::vector<double> &times)
+{
+	StepTimings::SetEnabled(true);
+	for(double time : times)
+	{
+		timings.Record(0, time);
+		timings.Record(1, time);
+		timings.Record(1, time);
+		timings.EndStep();
+	}
+	StepTimings::SetEnabled(false);
+}
+
+// #endregion mock data
+
+
+
+// #region unit tests
+SCENARIO( "Timing the phases of a step", "[stepTimings]" ) {
+	GIVEN( "timings for two phases" ) {
+		StepTimings timings(PHASES, 10);
+		REQUIRE( timings.PhaseCount() == 2 );
+		CHECK( timings.PhaseName(0) == "first" );
+		CHECK( timings.PhaseName(1) == "second" );
+
+		WHEN( "timing is disabled" ) {
+			StepTimings::SetEnabled(false);
+			TimeSteps(timings, 5);
+			THEN( "nothing is recorded" ) {
+				CHECK( timings.GetStats(0).average == 0. );
+				CHECK( timings.GetStats(1).p99 == 0. );
+			}
+		}
+		WHEN( "timing is enabled" ) {
+			StepTimings::SetEnabled(true);
+			TimeSteps(timings, 25);
+			StepTimings::SetEnabled(false);
+			THEN( "the statistics are consistent" ) {
+				for(size_t phase = 0; phase < timings.PhaseCount(); ++phase)
+				{
+					StepTimings::Stats stats = timings.GetStats(phase);
+					CHECK( stats.min >= 0. );
+					CHECK( stats.min <= stats.average );
+					CHECK( stats.average <= stats.p99 );
+				}
+			}
+			THEN( "the slower phase takes longer" ) {
+				CHECK( timings.GetStats(1).p99 > 0. );
+				CHECK( timings.GetStats(0).min <= timings.GetStats(1).p99 );
+			}
+		}
+	}
+	GIVEN( "timings that have recorded as many steps as they keep" ) {
+		StepTimings timings(PHASES, 100);
+		std::vector<double> times;
+		for(int i = 0; i < 100; ++i)
+			times.push_back((i * 37) % 100);
+		RecordSteps(timings, times);
+
+		THEN( "the statistics are those of the recorded times" ) {
+			StepTimings::Stats first = timings.GetStats(0);
+			CHECK( first.min == 0. );
+			CHECK( first.average == 49.5 );
+			CHECK( first.p99 == 98. );
+			StepTimings::Stats second = timings.GetStats(1);
+			CHECK( second.min == 0. );
+			CHECK( second.average == 99. );
+			CHECK( second.p99 == 196. );
+		}
+	}
+	GIVEN( "timings that have recorded more steps than they keep" ) {
+		StepTimings timings(PHASES, 4);
+		RecordSteps(timings, {100., 200., 3., 4., 5., 6.});
+
+		THEN( "only the most recent steps count" ) {
+			StepTimings::Stats stats = timings.GetStats(0);
+			CHECK( stats.min == 3. );
+			CHECK( stats.average == 4.5 );
+			CHECK( stats.p99 == 6. );
+		}
+		THEN( "the written steps go from the oldest to the newest" ) {
+			const std::string path = "step timings test.csv";
+			timings.WriteCSV(path);
+			std::string csv = Files::Read(path);
+			std::remove(path.c_str());
+			const std::string expected = "step,first,second\n"
+				"0,3.000000,6.000000\n"
+				"1,4.000000,8.000000\n"
+				"2,5.000000,10.000000\n"
+				"3,6.000000,12.000000\n";
+			CHECK( csv == expected );
+		}
+	}
+	GIVEN( "a dump request" ) {
+		StepTimings::RequestDump();
+		THEN( "it can only be taken once" ) {
+			CHECK( StepTimings::TakeDumpRequest() );
+			CHECK_FALSE( StepTimings::TakeDumpRequest() );
+		}
+	}
+}
+// #endregion unit tests
+
+
+
+} // test namespace
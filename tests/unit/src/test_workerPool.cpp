@@ -0,0 +1,85 @@
+/* test_workerPool.cpp
+Copyright (c) 2026 by Endless Sky contributors
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the tested class's header.
+#include "../../../source/WorkerPool.h"
+
+// ... and any system includes needed for the test file.
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+namespace { // test namespace
+
+// #region mock data
+// #endregion mock data
+
+
+
+// #region unit tests
+SCENARIO( "Creating a WorkerPool instance", "[workerPool]" ) {
+	GIVEN( "a number of threads" ) {
+		WorkerPool pool(3);
+		THEN( "it starts that many threads" ) {
+			CHECK( pool.ThreadCount() == 3 );
+		}
+	}
+	GIVEN( "no threads" ) {
+		WorkerPool pool(0);
+		THEN( "work is done on the calling thread" ) {
+			std::vector<int> order;
+			pool.Run(5, [&order](size_t i) { order.push_back(i); });
+			CHECK( order == std::vector<int>{0, 1, 2, 3, 4} );
+		}
+	}
+}
+
+SCENARIO( "A WorkerPool is handed work", "[workerPool]" ) {
+	GIVEN( "a pool with several threads" ) {
+		WorkerPool pool(4);
+		WHEN( "it is given a task" ) {
+			std::vector<int> calls(1000, 0);
+			pool.Run(calls.size(), [&calls](size_t i) { ++calls[i]; });
+			THEN( "every index is visited exactly once" ) {
+				CHECK( std::count(calls.begin(), calls.end(), 1) == static_cast<long>(calls.size()) );
+			}
+		}
+		WHEN( "it is given many tasks in a row" ) {
+			std::atomic<int> total(0);
+			for(int run = 0; run < 100; ++run)
+				pool.Run(run, [&total](size_t i) { total += i; });
+			THEN( "every task is completed before Run returns" ) {
+				int expected = 0;
+				for(int run = 0; run < 100; ++run)
+					expected += run * (run - 1) / 2;
+				CHECK( total == expected );
+			}
+		}
+		WHEN( "it is given no work" ) {
+			bool called = false;
+			pool.Run(0, [&called](size_t) { called = true; });
+			THEN( "nothing is called" ) {
+				CHECK_FALSE( called );
+			}
+		}
+	}
+}
+// #endregion unit tests
+
+
+
+} // test namespace
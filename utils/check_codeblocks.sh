@@ -11,6 +11,7 @@ cd "${HERE}"/.. || exit
 ESTOP=$(pwd)
 CBPROJECT="${ESTOP}/EndlessSkyLib.cbp"
 CBTPROJECT="${ESTOP}/EndlessSkyTests.cbp"
+CBBPROJECT="${ESTOP}/EndlessSkyBenchmarks.cbp"
 
 RESULT=0
 
@@ -38,4 +39,16 @@ do
   fi
 done
 
+for FILE in $(find tests/benchmarks/src -type f -name "*.h" -o -name "*.cpp" | sed s,^tests/benchmarks/src,, | sort)
+do
+  # Check if the file is already in the benchmark Code::Blocks project.
+  if ! grep -Fq "${FILE}" "${CBBPROJECT}"; then
+    if [ $RESULT -ne 3 ]; then
+      echo -e "\033[1mMissing files in EndlessSkyBenchmarks.cbp:\033[0m"
+    fi
+    echo -e "${FILE}"
+    RESULT=3
+  fi
+done
+
 exit ${RESULT}